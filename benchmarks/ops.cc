@@ -0,0 +1,513 @@
+#include <span>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <transform/mat/func.h>
+#include <transform/mat/matcxr.h>
+#include <transform/transform/basic.h>
+#include <transform/vec/func.h>
+#include <transform/vec/packet.h>
+#include <transform/vec/soa.h>
+#include <transform/vec/vecn.h>
+
+// Build once with -O0 and once with -O2 to compare debug and release cost.
+
+namespace {
+
+template <tf::usize L> tf::Vec<L, tf::f32> MakeVec() {
+  tf::Vec<L, tf::f32> vec;
+  for (tf::usize idx = 0; idx < L; ++idx) vec[idx] = static_cast<tf::f32>(idx + 1) * 0.5F;
+  return vec;
+}
+
+template <tf::usize N> tf::Mat<N, N, tf::f32> MakeMat() {
+  tf::Mat<N, N, tf::f32> mat;
+  for (tf::usize col = 0; col < N; ++col) mat[col] = MakeVec<N>() * static_cast<tf::f32>(col + 1);
+  return mat;
+}
+
+void BM_Vec4Add(benchmark::State& state) {
+  auto vec1 = MakeVec<4>();
+  auto vec2 = MakeVec<4>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vec1);
+    benchmark::DoNotOptimize(vec1 + vec2);
+  }
+}
+BENCHMARK(BM_Vec4Add);
+
+void BM_Vec4Dot(benchmark::State& state) {
+  auto vec1 = MakeVec<4>();
+  auto vec2 = MakeVec<4>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vec1);
+    benchmark::DoNotOptimize(tf::Dot(vec1, vec2));
+  }
+}
+BENCHMARK(BM_Vec4Dot);
+
+void BM_Vec4Normalize(benchmark::State& state) {
+  auto vec = MakeVec<4>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vec);
+    benchmark::DoNotOptimize(tf::Normalize(vec));
+  }
+}
+BENCHMARK(BM_Vec4Normalize);
+
+void BM_Vec4NormalizeFast(benchmark::State& state) {
+  auto vec = MakeVec<4>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vec);
+    benchmark::DoNotOptimize(tf::Normalize<tf::Fast>(vec));
+  }
+}
+BENCHMARK(BM_Vec4NormalizeFast);
+
+// Per-vertex normals: the whole batch is renormalized in place every iteration.
+template <typename P> void BM_Vec4NormalizeAll(benchmark::State& state) {
+  std::vector<tf::Vec<4, tf::f32>> vecs(static_cast<tf::usize>(state.range(0)), MakeVec<4>());
+  for (auto _ : state) {
+    tf::NormalizeAll<P>(std::span(vecs));
+    benchmark::DoNotOptimize(vecs.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * state.range(0)));
+}
+BENCHMARK(BM_Vec4NormalizeAll<tf::Exact>)->Arg(1024);
+BENCHMARK(BM_Vec4NormalizeAll<tf::Fast>)->Arg(1024);
+
+// Particle step pos += vel * dt, as an array of Vec3 and as a Vec3Soa.
+void BM_ParticleAos(benchmark::State& state) {
+  auto const count = static_cast<tf::usize>(state.range(0));
+  std::vector<tf::Vec<3, tf::f32>> pos(count, MakeVec<3>()), vel(count, MakeVec<3>() * 0.25F);
+  for (auto _ : state) {
+    for (tf::usize idx = 0; idx < count; ++idx) pos[idx] += vel[idx] * 0.016F;
+    benchmark::DoNotOptimize(pos.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * state.range(0)));
+}
+BENCHMARK(BM_ParticleAos)->Arg(4096)->Arg(5'000'000);
+
+void BM_ParticleSoa(benchmark::State& state) {
+  auto const count = static_cast<tf::usize>(state.range(0));
+  std::vector<tf::Vec<3, tf::f32>> const vecs(count, MakeVec<3>());
+  tf::Vec3Soa<tf::f32> pos{std::span(vecs)};
+  tf::Vec3Soa<tf::f32> vel = pos * 0.25F;
+  for (auto _ : state) {
+    pos.AddScaled(vel, 0.016F);
+    benchmark::DoNotOptimize(pos[0].data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * state.range(0)));
+}
+BENCHMARK(BM_ParticleSoa)->Arg(4096)->Arg(5'000'000);
+
+// Round trip through the component arrays.
+void BM_SoaLoadStore(benchmark::State& state) {
+  auto const count = static_cast<tf::usize>(state.range(0));
+  std::vector<tf::Vec<3, tf::f32>> vecs(count, MakeVec<3>());
+  tf::Vec3Soa<tf::f32> soa;
+  for (auto _ : state) {
+    soa.Load(std::span(vecs));
+    soa.Store(std::span(vecs));
+    benchmark::DoNotOptimize(vecs.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * state.range(0)));
+}
+BENCHMARK(BM_SoaLoadStore)->Arg(4096)->Arg(4000)->Arg(5'000'000);
+
+// Point transforms from L1-sized (12 KiB) to DRAM-sized (192 MiB) inputs, one Mat4 * Vec4(p, 1) per point against
+// the batched call.
+void PointSizes(benchmark::internal::Benchmark* bench) { bench->Arg(1 << 10)->Arg(1 << 15)->Arg(1 << 21)->Arg(1 << 24); }
+
+void BM_TransformPointsLoop(benchmark::State& state) {
+  auto const count = static_cast<tf::usize>(state.range(0));
+  auto const mat   = MakeMat<4>();
+  std::vector<tf::Vec<3, tf::f32>> const points(count, MakeVec<3>());
+  std::vector<tf::Vec<3, tf::f32>> out(count);
+  for (auto _ : state) {
+    for (tf::usize idx = 0; idx < count; ++idx) out[idx] = tf::Vec<3, tf::f32>(mat * tf::Vec<4, tf::f32>(points[idx], 1.0F));
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * state.range(0)));
+}
+BENCHMARK(BM_TransformPointsLoop)->Apply(PointSizes);
+
+void BM_TransformPoints(benchmark::State& state) {
+  auto const count = static_cast<tf::usize>(state.range(0));
+  auto const mat   = MakeMat<4>();
+  std::vector<tf::Vec<3, tf::f32>> const points(count, MakeVec<3>());
+  std::vector<tf::Vec<3, tf::f32>> out(count);
+  for (auto _ : state) {
+    tf::TransformPoints(mat, points, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * state.range(0)));
+}
+BENCHMARK(BM_TransformPoints)->Apply(PointSizes);
+
+// World matrices for an instance set: parent * local one Mat4 at a time against the batched call, from L1 sized
+// arrays to ones far beyond the cache.
+void MatrixSizes(benchmark::internal::Benchmark* bench) { bench->Arg(1000)->Arg(10000)->Arg(100000)->Arg(1000000)->Arg(10000000); }
+
+void BM_MultiplyAllLoop(benchmark::State& state) {
+  auto const count = static_cast<tf::usize>(state.range(0));
+  std::vector<tf::Mat<4, 4, tf::f32>> const parents(count, MakeMat<4>());
+  std::vector<tf::Mat<4, 4, tf::f32>> const locals(count, MakeMat<4>());
+  std::vector<tf::Mat<4, 4, tf::f32>> out(count);
+  for (auto _ : state) {
+    for (tf::usize idx = 0; idx < count; ++idx) out[idx] = parents[idx] * locals[idx];
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * state.range(0)));
+}
+BENCHMARK(BM_MultiplyAllLoop)->Apply(MatrixSizes);
+
+void BM_MultiplyAll(benchmark::State& state) {
+  auto const count = static_cast<tf::usize>(state.range(0));
+  std::vector<tf::Mat<4, 4, tf::f32>> const parents(count, MakeMat<4>());
+  std::vector<tf::Mat<4, 4, tf::f32>> const locals(count, MakeMat<4>());
+  std::vector<tf::Mat<4, 4, tf::f32>> out(count);
+  for (auto _ : state) {
+    tf::MultiplyAll(parents, locals, std::span(out));
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * state.range(0)));
+}
+BENCHMARK(BM_MultiplyAll)->Apply(MatrixSizes);
+
+void BM_MultiplyAllBroadcast(benchmark::State& state) {
+  auto const count = static_cast<tf::usize>(state.range(0));
+  auto const view  = MakeMat<4>();
+  std::vector<tf::Mat<4, 4, tf::f32>> const models(count, MakeMat<4>());
+  std::vector<tf::Mat<4, 4, tf::f32>> out(count);
+  for (auto _ : state) {
+    tf::MultiplyAll(view, models, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * state.range(0)));
+}
+BENCHMARK(BM_MultiplyAllBroadcast)->Apply(MatrixSizes);
+
+// Normals through the inverse transpose, renormalized: the per-element composition against the batched call.
+void BM_TransformNormalsLoop(benchmark::State& state) {
+  auto const count = static_cast<tf::usize>(state.range(0));
+  auto const mat   = MakeMat<4>() + tf::Mat<4, 4, tf::f32>::Identity();
+  std::vector<tf::Vec<3, tf::f32>> const normals(count, MakeVec<3>());
+  std::vector<tf::Vec<3, tf::f32>> out(count);
+  for (auto _ : state) {
+    auto const normal_mat = tf::Transpose(tf::Inverse(tf::Mat<3, 3, tf::f32>::Embed(mat)));
+    for (tf::usize idx = 0; idx < count; ++idx) out[idx] = tf::Normalize(normal_mat * normals[idx]);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * state.range(0)));
+}
+BENCHMARK(BM_TransformNormalsLoop)->Arg(1 << 10)->Arg(1 << 20);
+
+template <typename P> void BM_TransformNormals(benchmark::State& state) {
+  auto const count = static_cast<tf::usize>(state.range(0));
+  auto const mat   = MakeMat<4>() + tf::Mat<4, 4, tf::f32>::Identity();
+  std::vector<tf::Vec<3, tf::f32>> const normals(count, MakeVec<3>());
+  std::vector<tf::Vec<3, tf::f32>> out(count);
+  for (auto _ : state) {
+    tf::TransformNormals<P>(mat, normals, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * state.range(0)));
+}
+BENCHMARK(BM_TransformNormals<tf::Exact>)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_TransformNormals<tf::Fast>)->Arg(1 << 10)->Arg(1 << 20);
+
+// One templated reflection over 4096 directions, a Vec3 at a time and a packet at a time.
+template <typename V> V Reflect(V const& dir, V const& normal) { return Normalize(dir - normal * (2 * tf::Dot(dir, normal))); }
+
+void BM_ReflectVec3(benchmark::State& state) {
+  std::vector<tf::Vec<3, tf::f32>> dirs(4096, MakeVec<3>());
+  auto const normal = tf::Normalize(MakeVec<3>() - 1.0F);
+  for (auto _ : state) {
+    for (auto& dir : dirs) dir = Reflect(dir, normal);
+    benchmark::DoNotOptimize(dirs.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 4096));
+}
+BENCHMARK(BM_ReflectVec3);
+
+template <tf::usize N> void BM_ReflectPacket(benchmark::State& state) {
+  std::vector<tf::Vec<3, tf::f32>> dirs(4096, MakeVec<3>());
+  auto const normal = tf::Packet<tf::Vec<3, tf::f32>, N>(tf::Normalize(MakeVec<3>() - 1.0F));
+  for (auto _ : state) {
+    for (tf::usize idx = 0; idx < dirs.size(); idx += N) {
+      std::span<tf::Vec<3, tf::f32>> const lanes(dirs.data() + idx, N);
+      tf::StorePacket(Reflect(tf::LoadPacket<N>(lanes), normal), lanes);
+    }
+    benchmark::DoNotOptimize(dirs.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 4096));
+}
+BENCHMARK(BM_ReflectPacket<4>);
+BENCHMARK(BM_ReflectPacket<8>);
+BENCHMARK(BM_ReflectPacket<16>);
+
+// Branchless clamp through lane masks.
+void BM_Vec4SelectClamp(benchmark::State& state) {
+  auto       vec = MakeVec<4>() - 1.0F;
+  auto const lo  = tf::Vec<4, tf::f32>::Fill(-0.25F);
+  auto const hi  = tf::Vec<4, tf::f32>::Fill(0.75F);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vec);
+    benchmark::DoNotOptimize(tf::Select(vec > hi, hi, tf::Select(vec < lo, lo, vec)));
+  }
+}
+BENCHMARK(BM_Vec4SelectClamp);
+
+void BM_Vec4MulAdd(benchmark::State& state) {
+  auto vec1 = MakeVec<4>();
+  auto vec2 = MakeVec<4>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vec1);
+    vec2 += vec1 * 0.5F;
+    benchmark::DoNotOptimize(vec2);
+  }
+}
+BENCHMARK(BM_Vec4MulAdd);
+
+template <tf::usize N> void BM_MatAdd(benchmark::State& state) {
+  auto mat1 = MakeMat<N>();
+  auto mat2 = MakeMat<N>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat1);
+    benchmark::DoNotOptimize(mat1 + mat2);
+  }
+}
+BENCHMARK(BM_MatAdd<4>);
+BENCHMARK(BM_MatAdd<16>);
+
+template <tf::usize N> void BM_MatMulMat(benchmark::State& state) {
+  auto mat1 = MakeMat<N>();
+  auto mat2 = MakeMat<N>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat1);
+    benchmark::DoNotOptimize(mat1 * mat2);
+  }
+}
+BENCHMARK(BM_MatMulMat<4>);
+BENCHMARK(BM_MatMulMat<16>);
+
+#ifdef TRANSFORM_SIMD_SSE
+void BM_Mat4MulMatScalar(benchmark::State& state) {
+  auto mat1 = MakeMat<4>();
+  auto mat2 = MakeMat<4>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat1);
+    benchmark::DoNotOptimize(tf::operator*<4, 4, 4, tf::f32>(mat1, mat2));
+  }
+}
+BENCHMARK(BM_Mat4MulMatScalar);
+
+void BM_Mat4MulMatSse(benchmark::State& state) {
+  auto mat1 = MakeMat<4>();
+  auto mat2 = MakeMat<4>();
+  tf::Mat4<tf::f32> result;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat1);
+    tf::simd::MulSse(mat1.data(), mat2.data(), result.data());
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Mat4MulMatSse);
+
+void BM_Mat4MulVecScalar(benchmark::State& state) {
+  auto mat = MakeMat<4>();
+  auto vec = MakeVec<4>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(tf::operator*<4, 4, tf::f32>(mat, vec));
+  }
+}
+BENCHMARK(BM_Mat4MulVecScalar);
+
+void BM_Vec4MulMatScalar(benchmark::State& state) {
+  auto mat = MakeMat<4>();
+  auto vec = MakeVec<4>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(tf::operator*<4, 4, tf::f32>(vec, mat));
+  }
+}
+BENCHMARK(BM_Vec4MulMatScalar);
+
+void BM_Vec4MulMat(benchmark::State& state) {
+  auto mat = MakeMat<4>();
+  auto vec = MakeVec<4>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(vec * mat);
+  }
+}
+BENCHMARK(BM_Vec4MulMat);
+#endif
+
+#ifdef TRANSFORM_SIMD_AVX2
+void BM_Mat4MulMatAvx2(benchmark::State& state) {
+  auto mat1 = MakeMat<4>();
+  auto mat2 = MakeMat<4>();
+  tf::Mat4<tf::f32> result;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat1);
+    tf::simd::MulAvx2(mat1.data(), mat2.data(), result.data());
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Mat4MulMatAvx2);
+#endif
+
+template <tf::usize N> void BM_MatMulVec(benchmark::State& state) {
+  auto mat = MakeMat<N>();
+  auto vec = MakeVec<N>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(mat * vec);
+  }
+}
+BENCHMARK(BM_MatMulVec<4>);
+BENCHMARK(BM_MatMulVec<16>);
+
+template <tf::usize N> void BM_MatTranspose(benchmark::State& state) {
+  auto mat = MakeMat<N>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(tf::Transpose(mat));
+  }
+}
+BENCHMARK(BM_MatTranspose<4>);
+BENCHMARK(BM_MatTranspose<16>);
+
+// Reference first-row cofactor expansion, the algorithm Determinant used before.
+template <tf::usize N> tf::f64 LaplaceDeterminant(tf::Mat<N, N, tf::f64> const& mat) {
+  if constexpr (N == 1) {
+    return mat[0][0];
+  } else {
+    tf::f64 result{};
+    for (tf::usize col = 0; col < N; ++col) result = mat[col][0] * (col % 2 == 0 ? 1.0 : -1.0) * LaplaceDeterminant(tf::CutDown(mat, col, 0)) + result;
+    return result;
+  }
+}
+
+template <tf::usize N> tf::Mat<N, N, tf::f64> MakeWellConditioned() {
+  tf::Mat<N, N, tf::f64> mat;
+  for (tf::usize col = 0; col < N; ++col)
+    for (tf::usize row = 0; row < N; ++row) mat[col][row] = col == row ? 4.0 : 1.0 / static_cast<tf::f64>(col + row + 1);
+  return mat;
+}
+
+template <tf::usize N> void BM_DeterminantLaplace(benchmark::State& state) {
+  auto mat = MakeWellConditioned<N>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(LaplaceDeterminant(mat));
+  }
+}
+BENCHMARK(BM_DeterminantLaplace<4>);
+BENCHMARK(BM_DeterminantLaplace<6>);
+BENCHMARK(BM_DeterminantLaplace<8>);
+
+template <tf::usize N> void BM_Determinant(benchmark::State& state) {
+  auto mat = MakeWellConditioned<N>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(tf::Determinant(mat));
+  }
+}
+BENCHMARK(BM_Determinant<4>);
+BENCHMARK(BM_Determinant<6>);
+BENCHMARK(BM_Determinant<8>);
+BENCHMARK(BM_Determinant<16>);
+
+template <tf::usize N> void BM_InverseAdjugate(benchmark::State& state) {
+  auto mat = MakeWellConditioned<N>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(1.0 / tf::Determinant(mat) * tf::Transpose(tf::CofactorMatrix(mat)));
+  }
+}
+BENCHMARK(BM_InverseAdjugate<2>);
+BENCHMARK(BM_InverseAdjugate<3>);
+BENCHMARK(BM_InverseAdjugate<4>);
+
+template <tf::usize N> void BM_Inverse(benchmark::State& state) {
+  auto mat = MakeWellConditioned<N>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(tf::Inverse(mat));
+  }
+}
+BENCHMARK(BM_Inverse<2>);
+BENCHMARK(BM_Inverse<3>);
+BENCHMARK(BM_Inverse<4>);
+
+void BM_InverseView(benchmark::State& state) {
+  auto mat = tf::LookAt(tf::Vec3<tf::f32>(3, 4, 5), tf::Vec3<tf::f32>(0, 1, 0), tf::Vec3<tf::f32>(0, 0, 0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(tf::Inverse(mat));
+  }
+}
+BENCHMARK(BM_InverseView);
+
+void BM_InverseViewAffine(benchmark::State& state) {
+  auto mat = tf::LookAt(tf::Vec3<tf::f32>(3, 4, 5), tf::Vec3<tf::f32>(0, 1, 0), tf::Vec3<tf::f32>(0, 0, 0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(tf::InverseAffine(mat));
+  }
+}
+BENCHMARK(BM_InverseViewAffine);
+
+void BM_InverseViewRigid(benchmark::State& state) {
+  auto mat = tf::LookAt(tf::Vec3<tf::f32>(3, 4, 5), tf::Vec3<tf::f32>(0, 1, 0), tf::Vec3<tf::f32>(0, 0, 0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(tf::InverseRigid(mat));
+  }
+}
+BENCHMARK(BM_InverseViewRigid);
+
+template <typename T> tf::Mat4<T> MakeMat4() {
+  tf::Mat4<T> mat;
+  for (tf::usize col = 0; col < 4; ++col)
+    for (tf::usize row = 0; row < 4; ++row) mat[col][row] = col == row ? T{4} : static_cast<T>(col + 2 * row + 1) / T{16};
+  return mat;
+}
+
+// Mat4<f64>: compare against a build without TRANSFORM_SIMD, or with -mavx / -mavx2 -mfma.
+void BM_Mat4dMulMat(benchmark::State& state) {
+  auto mat1 = MakeMat4<tf::f64>();
+  auto mat2 = MakeMat4<tf::f64>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat1);
+    benchmark::DoNotOptimize(mat1 * mat2);
+  }
+}
+BENCHMARK(BM_Mat4dMulMat);
+
+void BM_Mat4dMulVec(benchmark::State& state) {
+  auto mat = MakeMat4<tf::f64>();
+  auto vec = tf::Vec4<tf::f64>(1.0, 2.0, 3.0, 1.0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(mat * vec);
+  }
+}
+BENCHMARK(BM_Mat4dMulVec);
+
+template <typename T> void BM_Mat4Inverse(benchmark::State& state) {
+  auto mat = MakeMat4<T>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mat);
+    benchmark::DoNotOptimize(tf::Inverse(mat));
+  }
+}
+BENCHMARK(BM_Mat4Inverse<tf::f32>);
+BENCHMARK(BM_Mat4Inverse<tf::f64>);
+
+}  // namespace
@@ -0,0 +1,185 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <transform/kernels/kernels.h>
+#include <transform/mat/matcxr.h>
+#include <transform/vec/func.h>
+#include <transform/vec/vec3.h>
+#include <transform/vec/vec4.h>
+
+#include <gtest/gtest.h>
+#include <tests/util.h>
+
+namespace tf::test {
+
+namespace {
+
+using kernels::Level;
+
+Vec4<f32> MakeVec(f32 seed) {
+  return Vec4<f32>(std::sin(seed) * 5.0F, std::cos(seed * 1.3F) * 2.0F, std::sin(seed * 0.7F) + 1.5F, std::cos(seed * 2.1F));
+}
+
+// Runs `check` at every level the host supports, restoring the detected level afterwards.
+template <typename Fn> void ForEachLevel(Fn check) {
+  for (Level level : {Level::kScalar, Level::kSse4, Level::kAvx2, Level::kAvx512}) {
+    if (level > kernels::SupportedLevel()) break;
+    kernels::ForceLevel(level);
+    ASSERT_EQ(kernels::ActiveLevel(), level);
+    SCOPED_TRACE(kernels::LevelName(level));
+    check();
+  }
+  kernels::ForceLevel(kernels::SupportedLevel());
+}
+
+}  // namespace
+
+// Must run first: the level chosen at first use honours TRANSFORM_KERNELS_LEVEL.
+TEST(KernelsTest, InitialLevel) {
+  char const* env = std::getenv("TRANSFORM_KERNELS_LEVEL");
+  if (env != nullptr) EXPECT_STREQ(kernels::LevelName(kernels::ActiveLevel()), env);
+  else EXPECT_EQ(kernels::ActiveLevel(), kernels::SupportedLevel());
+}
+
+TEST(KernelsTest, ForceLevel) {
+  kernels::ForceLevel(Level::kAvx512);
+  EXPECT_EQ(kernels::ActiveLevel(), kernels::SupportedLevel());
+  kernels::ForceLevel(Level::kScalar);
+  EXPECT_EQ(kernels::ActiveLevel(), Level::kScalar);
+  kernels::ForceLevel(kernels::SupportedLevel());
+  EXPECT_STREQ(kernels::LevelName(Level::kSse4), "sse4");
+}
+
+TEST(KernelsTest, Transform) {
+  Mat4<f32> const kMat = MakeMat(0.3F);
+  // Every batch size up to a few registers, to cover the tails of each level.
+  ForEachLevel([&] {
+    for (usize count = 0; count <= 13; ++count) {
+      std::vector<Vec4<f32>> vecs(count), out(count);
+      for (usize idx = 0; idx < count; ++idx) vecs[idx] = MakeVec(static_cast<f32>(idx));
+      kernels::Transform(kMat, vecs.data(), out.data(), count);
+      for (usize idx = 0; idx < count; ++idx) ExpectNear(out[idx], kMat * vecs[idx]);
+
+      kernels::Transform(kMat, vecs.data(), vecs.data(), count);
+      for (usize idx = 0; idx < count; ++idx) EXPECT_EQ(vecs[idx], out[idx]);
+    }
+  });
+}
+
+TEST(KernelsTest, Normalize) {
+  ForEachLevel([&] {
+    for (usize count = 0; count <= 13; ++count) {
+      std::vector<Vec4<f32>> vecs(count), out(count);
+      for (usize idx = 0; idx < count; ++idx) vecs[idx] = MakeVec(static_cast<f32>(idx) + 0.5F);
+      kernels::Normalize(vecs.data(), out.data(), count);
+      for (usize idx = 0; idx < count; ++idx) ExpectNear(out[idx], Normalize(vecs[idx]));
+    }
+  });
+}
+
+TEST(KernelsTest, Multiply) {
+  ForEachLevel([&] {
+    for (usize count = 0; count <= 5; ++count) {
+      std::vector<Mat4<f32>> lhs(count), rhs(count), out(count);
+      for (usize idx = 0; idx < count; ++idx) {
+        lhs[idx] = MakeMat(static_cast<f32>(idx));
+        rhs[idx] = MakeMat(static_cast<f32>(idx) + 7.0F);
+      }
+      kernels::Multiply(lhs.data(), rhs.data(), out.data(), count);
+      for (usize idx = 0; idx < count; ++idx) ExpectNear(out[idx], lhs[idx] * rhs[idx], 1e-4F);
+
+      kernels::Multiply(lhs.data(), rhs.data(), lhs.data(), count);
+      for (usize idx = 0; idx < count; ++idx) EXPECT_EQ(lhs[idx], out[idx]);
+    }
+  });
+}
+
+TEST(KernelsTest, Saturate) {
+  // Every edge of the u8 and i16 ranges, over lengths that cover each level's block and tail.
+  std::vector<u8>  bytes1, bytes2;
+  std::vector<i16> words1, words2;
+  for (usize idx = 0; idx < 200; ++idx) {
+    bytes1.push_back(static_cast<u8>(idx * 37 + 11));
+    bytes2.push_back(static_cast<u8>(idx * 91 + 250));
+    words1.push_back(static_cast<i16>(static_cast<i32>(idx * 9973) % 65536 - 32768));
+    words2.push_back(static_cast<i16>(static_cast<i32>(idx * 4001) % 65536 - 32768));
+  }
+  ForEachLevel([&] {
+    for (usize count : {usize{0}, usize{1}, usize{15}, usize{16}, usize{33}, usize{64}, usize{127}, usize{200}}) {
+      std::vector<u8>  bytes(count);
+      std::vector<i16> words(count);
+      auto const kCheckBytes = [&](auto op) { for (usize idx = 0; idx < count; ++idx) EXPECT_EQ(bytes[idx], op(bytes1[idx], bytes2[idx])) << count << ", " << idx; };
+      auto const kCheckWords = [&](auto op) { for (usize idx = 0; idx < count; ++idx) EXPECT_EQ(words[idx], op(words1[idx], words2[idx])) << count << ", " << idx; };
+
+      kernels::AddSat (bytes1.data(), bytes2.data(), bytes.data(), count); kCheckBytes(AddSat<u8>);
+      kernels::SubSat (bytes1.data(), bytes2.data(), bytes.data(), count); kCheckBytes(SubSat<u8>);
+      kernels::Average(bytes1.data(), bytes2.data(), bytes.data(), count); kCheckBytes(Average<u8>);
+      kernels::AddSat (words1.data(), words2.data(), words.data(), count); kCheckWords(AddSat<i16>);
+      kernels::SubSat (words1.data(), words2.data(), words.data(), count); kCheckWords(SubSat<i16>);
+      kernels::MulHigh(words1.data(), words2.data(), words.data(), count); kCheckWords(MulHigh<i16>);
+
+      kernels::Pack(words1.data(), bytes.data(), count);
+      for (usize idx = 0; idx < count; ++idx) EXPECT_EQ(bytes[idx], SaturateCast<u8>(words1[idx])) << count << ", " << idx;
+      kernels::Unpack(bytes1.data(), words.data(), count);
+      for (usize idx = 0; idx < count; ++idx) EXPECT_EQ(words[idx], bytes1[idx]) << count << ", " << idx;
+
+      // In place, the bytes at the start of the word buffer.
+      std::vector<i16> in_place(words1.begin(), words1.begin() + static_cast<std::ptrdiff_t>(count));
+      u8* const in_place_bytes = reinterpret_cast<u8*>(in_place.data());
+      kernels::Pack(in_place.data(), in_place_bytes, count);
+      for (usize idx = 0; idx < count; ++idx) EXPECT_EQ(in_place_bytes[idx], SaturateCast<u8>(words1[idx])) << count << ", " << idx;
+      std::memcpy(in_place_bytes, bytes1.data(), count);
+      kernels::Unpack(in_place_bytes, in_place.data(), count);
+      for (usize idx = 0; idx < count; ++idx) EXPECT_EQ(in_place[idx], bytes1[idx]) << count << ", " << idx;
+    }
+
+    // Vec4<u8> pixels, in place.
+    std::vector<Vec4<u8>> pixels(9, Vec4<u8>(250, 5, 128, 255));
+    std::vector<Vec4<u8>> const kDelta(9, Vec4<u8>(10, 10, 10, 10));
+    kernels::AddSat(pixels.data(), kDelta.data(), pixels.data(), pixels.size());
+    for (Vec4<u8> const& pixel : pixels) EXPECT_EQ(pixel, Vec4<u8>(255, 15, 138, 255));
+    std::vector<Vec4<i16>> wide(9);
+    kernels::Unpack(pixels.data(), wide.data(), wide.size());
+    kernels::Pack(wide.data(), pixels.data(), pixels.size());
+    for (usize idx = 0; idx < 9; ++idx) EXPECT_EQ(wide[idx], Vec4<i16>(255, 15, 138, 255));
+  });
+}
+
+TEST(KernelsTest, TransformSoa) {
+  Mat4<f32> const kMat4 = MakeMat(1.7F);
+  Mat3<f32> const kMat3 = Mat3<f32>::Embed(kMat4);
+  // Past one AVX-512 register, so the full loop and every tail length run.
+  ForEachLevel([&] {
+    for (usize count = 0; count <= 37; ++count) {
+      std::vector<f32> xs(count), ys(count), zs(count), out_xs(count), out_ys(count), out_zs(count);
+      for (usize idx = 0; idx < count; ++idx) {
+        Vec4<f32> const vec = MakeVec(static_cast<f32>(idx));
+        xs[idx] = vec[0];
+        ys[idx] = vec[1];
+        zs[idx] = vec[2];
+      }
+
+      kernels::TransformSoa(kMat3, xs.data(), ys.data(), zs.data(), out_xs.data(), out_ys.data(), out_zs.data(), count);
+      for (usize idx = 0; idx < count; ++idx) {
+        Vec3<f32> const res = kMat3 * Vec3<f32>(xs[idx], ys[idx], zs[idx]);
+        EXPECT_NEAR(out_xs[idx], res[0], 1e-5F) << idx;
+        EXPECT_NEAR(out_ys[idx], res[1], 1e-5F) << idx;
+        EXPECT_NEAR(out_zs[idx], res[2], 1e-5F) << idx;
+      }
+
+      kernels::TransformSoa(kMat4, xs.data(), ys.data(), zs.data(), xs.data(), ys.data(), zs.data(), count);
+      for (usize idx = 0; idx < count; ++idx) {
+        Vec4<f32> const vec = MakeVec(static_cast<f32>(idx));
+        Vec4<f32> const res = kMat4 * Vec4<f32>(vec[0], vec[1], vec[2], 1.0F);
+        EXPECT_NEAR(xs[idx], res[0], 1e-5F) << idx;
+        EXPECT_NEAR(ys[idx], res[1], 1e-5F) << idx;
+        EXPECT_NEAR(zs[idx], res[2], 1e-5F) << idx;
+      }
+    }
+  });
+}
+
+}  // namespace tf::test
@@ -0,0 +1,33 @@
+#include <transform/mat/aligned.h>
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+#include <transform/mat/matcxr.h>
+
+namespace tf::test {
+
+TEST(MatTest, Aligned) {
+  Mat4<f32> constexpr kMat1 = Mat4<f32>::Identity();
+  Vec4<f32> constexpr kVec1(1.0F, 2.0F, 3.0F, 4.0F);
+
+  static_assert(alignof(AlignedMat4<f32>) == 64);
+  static_assert(alignof(AlignedMat<4, 4, f32, 16>) == 16);
+
+  AlignedMat4<f32> mats[2] = {AlignedMat4<f32>(kMat1), AlignedMat4<f32>(kMat1 * 2.0F)};
+
+  for (auto const& mat : mats) EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mat.data()) % 64, 0U);
+
+  EXPECT_EQ(mats[0], kMat1);
+  EXPECT_EQ(mats[1], kMat1 * 2.0F);
+  EXPECT_EQ(mats[0] * mats[1], mats[1]);
+  EXPECT_EQ(mats[1] * kVec1, kVec1 * 2.0F);
+
+  mats[0] = mats[0] * mats[1];
+  EXPECT_EQ(mats[0].packed(), kMat1 * 2.0F);
+
+  AlignedMat4<f32> const mat(kVec1, kVec1, kVec1, kVec1);
+  EXPECT_EQ(mat[3], kVec1);
+}
+
+}  // namespace tf::test
@@ -17,6 +17,13 @@ TEST(MatTest, Func) {
   Mat3<i32> constexpr kMatA(1, 2, 3, 4, 5, 6, 7, 8, 9);
   Mat3<i32> constexpr kMatB(1, 4, 7, 2, 5, 8, 3, 6, 9);
 
+  Mat4<i32>          constexpr kMat4(1, 2, 0, 4, 3, 0, 1, 2, 0, 1, 5, 3, 2, 2, 1, 0);
+  Mat<5, 5, i32>     constexpr kMat5(0, 2, 1, 3, 1, 1, 0, 2, 1, 4, 3, 1, 0, 2, 2, 2, 4, 1, 0, 3, 1, 3, 2, 4, 0);
+  Mat<6, 6, i32>     constexpr kMat6(2, 0, 1, 3, 1, 5, 1, 3, 2, 1, 4, 0, 3, 1, 4, 2, 2, 1, 2, 4, 1, 5, 3, 2, 1, 3, 2, 4, 0, 3, 4, 1, 3, 2, 5, 2);
+  Mat<5, 5, i32> constexpr kSingular5(1, 2, 3, 4, 5, 2, 4, 6, 8, 10, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 3, 3, 3, 3, 3);
+  // The products of minors inside the elimination overflow i32 although the determinant fits.
+  Mat<5, 5, i32> constexpr kLarge5(17, 15, -16, 15, -15, -21, 16, -16, 15, -18, -21, -18, -17, 21, -16, 17, -18, 16, -15, -22, 20, 22, 19, -17, -16);
+
   EXPECT_EQ(CutDown(kIdentity2, 0, 0), kIdentity1);
   EXPECT_NE(CutDown(kIdentity2, 0, 1), kIdentity1);
   EXPECT_NE(CutDown(kIdentity2, 1, 0), kIdentity1);
@@ -38,6 +45,24 @@ TEST(MatTest, Func) {
   EXPECT_EQ(Determinant(kIdentityA), 8);
   EXPECT_EQ(Determinant(kIdentityB), 27);
   EXPECT_EQ(Determinant(kIdentityA * kIdentityB),  8 * 27);
+  EXPECT_EQ(Determinant(kMat4), 150);
+  EXPECT_EQ(Determinant(kMat5), 256);
+  EXPECT_EQ(Determinant(kMat6), 216);
+  EXPECT_EQ(Determinant(kSingular5), 0);
+  EXPECT_EQ(Determinant(Transpose(kMat6)), 216);
+  EXPECT_EQ(Determinant(kLarge5), -5920466);
+  EXPECT_EQ(Determinant(Transpose(kLarge5)), -5920466);
+  EXPECT_EQ(Determinant(Mat<5, 5, u32>(kMat5)), 256U);
+  EXPECT_EQ(Determinant(Mat<5, 5, u32>(kLarge5)), static_cast<u32>(-5920466));
+  EXPECT_EQ(Determinant(Mat<5, 5, i64>(kLarge5)), -5920466);
+  EXPECT_EQ(Determinant(Mat<5, 5, u64>(kMat5)), 256U);
+  EXPECT_DOUBLE_EQ(Determinant(Mat<5, 5, f64>(kMat5)), 256.0);
+  EXPECT_NEAR(Determinant(Mat<6, 6, f64>(kMat6)), 216.0, 1e-9);
+  EXPECT_EQ(Determinant(Mat<5, 5, f64>(kSingular5)), 0.0);
+
+  static_assert(Determinant(kMat5) == 256);
+  static_assert(Determinant(kLarge5) == -5920466);
+  static_assert(Determinant(kMat4) == Determinant(Transpose(kMat4)));
 
   EXPECT_EQ(CofactorMatrix(kIdentity2), kIdentity2);
   EXPECT_EQ(CofactorMatrix(kIdentity3), kIdentity3);
@@ -50,4 +75,34 @@ TEST(MatTest, Func) {
   EXPECT_EQ(kIdentityA * Inverse(kIdentityA), Mat3<f32>(kIdentity3));
 }
 
+TEST(MatTest, FuncInverse) {
+  Mat2<f64> const kMat2(4, 7, 2, 6);
+  Mat3<f64> const kMat3(2, 0, 1, 1, 3, 2, 1, 1, 2);
+  Mat4<f64> const kMat4(1, 2, 0, 4, 3, 0, 1, 2, 0, 1, 5, 3, 2, 2, 1, 0);
+
+  auto expect_identity = []<usize N>(Mat<N, N, f64> const& mat) {
+    for (usize col = 0; col < N; ++col)
+      for (usize row = 0; row < N; ++row) EXPECT_NEAR(mat[col][row], col == row ? 1.0 : 0.0, 1e-12) << col << ", " << row;
+  };
+  expect_identity(Inverse(kMat2) * kMat2);
+  expect_identity(kMat2 * Inverse(kMat2));
+  expect_identity(Inverse(kMat3) * kMat3);
+  expect_identity(kMat3 * Inverse(kMat3));
+  expect_identity(Inverse(kMat4) * kMat4);
+  expect_identity(kMat4 * Inverse(kMat4));
+
+  // The closed forms agree with the adjugate definition.
+  auto expect_adjugate = []<usize N>(Mat<N, N, f64> const& mat) {
+    auto ref = 1.0 / Determinant(mat) * Transpose(CofactorMatrix(mat));
+    auto inv = Inverse(mat);
+    for (usize col = 0; col < N; ++col)
+      for (usize row = 0; row < N; ++row) EXPECT_NEAR(inv[col][row], ref[col][row], 1e-12) << col << ", " << row;
+  };
+  expect_adjugate(kMat2);
+  expect_adjugate(kMat3);
+  expect_adjugate(kMat4);
+
+  static_assert(Inverse(Mat4<f64>::Identity() * 2.0) == Mat4<f64>::Identity() * 0.5);
+}
+
 }  // namespace tf::test
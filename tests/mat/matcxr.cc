@@ -1,5 +1,10 @@
 #include <transform/mat/matcxr.h>
 
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <transform/vec/vecn.h>
 
@@ -63,4 +68,70 @@ TEST(MatTest, MatCxR) {
   EXPECT_EQ(kVecA * kMat3, kMat3.headr());
 }
 
+TEST(MatTest, MatCxRLayout) {
+  Mat3<i32> constexpr kMat3(1, 2, 3, 4, 5, 6, 7, 8, 9);
+
+  EXPECT_EQ(sizeof(Mat4<f32>), 16 * sizeof(f32));
+  EXPECT_EQ(sizeof(Mat<2, 3, f64>), 6 * sizeof(f64));
+
+  for (usize idx = 0; idx < 9; ++idx) EXPECT_EQ(kMat3.data()[idx], static_cast<i32>(idx + 1));
+  EXPECT_EQ(kMat3.data() + 3, kMat3[1].data());
+
+  Mat4<f32> mats[2] = {Mat4<f32>::Identity(), Mat4<f32>::Identity() * 2.0F};
+  f32 buffer[32] = {};
+
+  std::memcpy(buffer, mats[0].data(), sizeof(mats));
+  EXPECT_FLOAT_EQ(buffer[ 0], 1.0F);
+  EXPECT_FLOAT_EQ(buffer[ 5], 1.0F);
+  EXPECT_FLOAT_EQ(buffer[16], 2.0F);
+  EXPECT_FLOAT_EQ(buffer[31], 2.0F);
+
+  Mat4<f32> copy{};
+  std::memcpy(copy.data(), buffer + 16, sizeof(copy));
+  EXPECT_EQ(copy, mats[1]);
+}
+
+TEST(MatTest, MatCxRTrivialCopy) {
+  static_assert(std::is_trivially_copyable_v<Mat4<f32>>);
+  static_assert(std::is_trivially_copy_constructible_v<Mat4<f32>>);
+  static_assert(std::is_trivially_copy_assignable_v<Mat4<f32>>);
+  static_assert(std::is_standard_layout_v<Mat4<f32>>);
+  // What std::vector checks before relocating its elements with memmove on growth.
+  static_assert(std::is_trivially_move_constructible_v<Mat4<f32>> && std::is_trivially_destructible_v<Mat4<f32>>);
+  static_assert(std::is_nothrow_move_constructible_v<Mat4<f32>>);
+
+  // The static_asserts above are the guarantee that the standard library may copy and relocate with memmove; which
+  // call it emits is not observable here, so the rest only checks that bulk copies and growth keep every value.
+  std::vector<Mat4<f32>> src(64);
+  for (usize idx = 0; idx < src.size(); ++idx) src[idx] = Mat4<f32>::Identity() * static_cast<f32>(idx);
+
+  std::vector<Mat4<f32>> dst(src.size());
+  std::copy(src.begin(), src.end(), dst.begin());
+  EXPECT_EQ(std::memcmp(src.data(), dst.data(), src.size() * sizeof(Mat4<f32>)), 0);
+
+  dst.resize(2 * src.size());
+  std::copy_backward(src.begin(), src.end(), dst.end());
+  EXPECT_EQ(dst[0], dst[src.size()]);
+  EXPECT_EQ(dst.back(), src.back());
+
+  std::vector<Mat4<f32>> grown = src;
+  grown.reserve(4 * src.size());
+  EXPECT_EQ(std::memcmp(grown.data(), src.data(), src.size() * sizeof(Mat4<f32>)), 0);
+}
+
+TEST(MatTest, MatCxRElementCount) {
+  static_assert( std::is_constructible_v<Mat2<f32>, f32, f32, f32, f32>);
+  static_assert( std::is_constructible_v<Mat2<f32>, f32, f32, f32>);
+  static_assert(!std::is_constructible_v<Mat2<f32>, f32, f32, f32, f32, f32>);
+  static_assert(!std::is_constructible_v<Mat2<f32>, Vec2<f32>, Vec2<f32>, f32>);
+  static_assert(!std::is_constructible_v<Mat2<f32>, Vec3<f32>, Vec2<f32>>);
+  static_assert(!std::is_constructible_v<Mat2<f32>, Mat2<f32>, f32>);
+  static_assert(!std::is_constructible_v<Mat<3, 2, f32>, f32, f32, f32, f32, f32, f32, f32>);
+  static_assert(!std::is_constructible_v<Mat<2, 1, f32>, f32, f32, f32>);
+  static_assert(!std::is_constructible_v<Mat<1, 2, f32>, f32, f32, f32>);
+
+  // Fewer elements than the matrix holds leave the rest zero.
+  EXPECT_EQ(Mat2<i32>(Vec3<i32>(1, 2, 3)), Mat2<i32>(1, 2, 3, 0));
+}
+
 }  // namespace tf::test
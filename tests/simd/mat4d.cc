@@ -0,0 +1,57 @@
+// Exercise the SIMD overloads even when the rest of the tests build without the backend.
+#ifndef TRANSFORM_SIMD
+#define TRANSFORM_SIMD
+#endif
+
+#include <transform/mat/func.h>
+#include <transform/mat/matcxr.h>
+#include <transform/simd/mat4d.h>
+
+#include <gtest/gtest.h>
+#include <tests/util.h>
+
+namespace tf::test {
+
+#ifdef TRANSFORM_SIMD_AVX
+
+TEST(SimdTest, Mat4d) {
+  if (!HostSupportsTarget()) GTEST_SKIP() << "No AVX on this host";
+
+  Mat4<f64> const kMatA = MakeMat(0.37);
+  Mat4<f64> const kMatB = MakeMat(1.91);
+  Vec4<f64> const kVec(0.25, -1.5, 2.0, 3.75);
+
+  // The row form and the inverse never fuse, so they match the scalar templates exactly, unless
+  // the compiler contracts the scalar minors itself once FMA is targeted (GCC does at -O2).
+  EXPECT_EQ(kVec * kMatA, (operator*<4, 4, f64>(kVec, kMatA)));
+#ifdef TRANSFORM_SIMD_AVX2
+  ExpectNear(Inverse(kMatA), Inverse<f64>(kMatA));
+#else
+  EXPECT_EQ(Inverse(kMatA), Inverse<f64>(kMatA));
+#endif
+  ExpectNear(Inverse(kMatA) * kMatA, Mat4<f64>::Identity());
+
+#ifdef TRANSFORM_SIMD_AVX2
+  for (usize idx = 0; idx < 4; ++idx) EXPECT_NEAR((kMatA * kVec)[idx], (operator*<4, 4, f64>(kMatA, kVec))[idx], 1e-12) << idx;
+  EXPECT_EQ(kMatA * kMatB, (operator*<4, 4, 4, f64>(kMatA, kMatB)));
+#else
+  Vec4<f64> column = kMatA[3] * kVec[3];
+  for (usize idx = 3; idx-- > 0;) column = kMatA[idx] * kVec[idx] + column;
+  EXPECT_EQ(kMatA * kVec, column);
+  EXPECT_EQ(kMatA * kMatB, (operator*<4, 4, 4, f64>(kMatA, kMatB)));
+#endif
+}
+
+TEST(SimdTest, Mat4dConstexpr) {
+  Mat4<f64> constexpr kMat = Mat4<f64>::Identity() * 2.0;
+  Vec4<f64> constexpr kVec(1.0, 2.0, 3.0, 4.0);
+
+  static_assert(kMat * kMat == Mat4<f64>::Identity() * 4.0);
+  static_assert(kMat * kVec == kVec * 2.0);
+  static_assert(kVec * kMat == kVec * 2.0);
+  static_assert(Inverse(kMat) == Mat4<f64>::Identity() * 0.5);
+}
+
+#endif  // TRANSFORM_SIMD_AVX
+
+}  // namespace tf::test
@@ -0,0 +1,146 @@
+// Exercise the portable overloads next to the intrinsic ones, so each backend checks the other.
+#ifndef TRANSFORM_SIMD
+#define TRANSFORM_SIMD
+#endif
+#ifndef TRANSFORM_SIMD_PORTABLE
+#define TRANSFORM_SIMD_PORTABLE
+#endif
+
+#include <transform/mat/matcxr.h>
+#include <transform/simd/config.h>
+#include <transform/vec/vecn.h>
+
+#include <gtest/gtest.h>
+
+namespace tf::test {
+
+#ifdef TRANSFORM_SIMD_PORTABLE_STDX
+
+namespace {
+
+namespace stdx = std::experimental;
+
+template <usize L, typename T> Vec<L, T> MakeVec(T start, T step) {
+  Vec<L, T> result;
+  for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(start + static_cast<T>(idx) * step);
+  return result;
+}
+
+template <usize C, usize R, typename T> Mat<C, R, T> MakeMat(T start, T step) {
+  Mat<C, R, T> result;
+  for (usize idx = 0; idx < C; ++idx) result[idx] = MakeVec<R, T>(static_cast<T>(start + static_cast<T>(idx * R) * step), step);
+  return result;
+}
+
+// Element-wise reference written as the plain loop the generic templates use.
+template <usize L, typename T, typename Op> Vec<L, T> Reference(Vec<L, T> const& vec1, Vec<L, T> const& vec2, Op op) {
+  Vec<L, T> result;
+  for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(op(vec1[idx], vec2[idx]));
+  return result;
+}
+
+template <usize L, typename T> void ExpectVecOps(Vec<L, T> const& vec1, Vec<L, T> const& vec2, T sca) {
+  Vec<L, T> const kSca = Vec<L, T>::Fill(sca);
+
+  EXPECT_EQ(vec1 + vec2, Reference(vec1, vec2, [](T lhs, T rhs) { return lhs + rhs; }));
+  EXPECT_EQ(vec1 - vec2, Reference(vec1, vec2, [](T lhs, T rhs) { return lhs - rhs; }));
+  EXPECT_EQ(vec1 * vec2, Reference(vec1, vec2, [](T lhs, T rhs) { return lhs * rhs; }));
+  EXPECT_EQ(vec1 / vec2, Reference(vec1, vec2, [](T lhs, T rhs) { return lhs / rhs; }));
+
+  EXPECT_EQ(vec1 + sca, Reference(vec1, kSca, [](T lhs, T rhs) { return lhs + rhs; }));
+  EXPECT_EQ(vec1 - sca, Reference(vec1, kSca, [](T lhs, T rhs) { return lhs - rhs; }));
+  EXPECT_EQ(vec1 * sca, Reference(vec1, kSca, [](T lhs, T rhs) { return lhs * rhs; }));
+  EXPECT_EQ(vec1 / sca, Reference(vec1, kSca, [](T lhs, T rhs) { return lhs / rhs; }));
+
+  EXPECT_EQ(sca + vec2, Reference(kSca, vec2, [](T lhs, T rhs) { return lhs + rhs; }));
+  EXPECT_EQ(sca - vec2, Reference(kSca, vec2, [](T lhs, T rhs) { return lhs - rhs; }));
+  EXPECT_EQ(sca * vec2, Reference(kSca, vec2, [](T lhs, T rhs) { return lhs * rhs; }));
+  EXPECT_EQ(sca / vec2, Reference(kSca, vec2, [](T lhs, T rhs) { return lhs / rhs; }));
+
+  EXPECT_EQ(-vec1, Reference(vec1, vec1, [](T lhs, T) { return -lhs; }));
+}
+
+template <usize C, usize R, typename T> void ExpectMatOps(Mat<C, R, T> const& mat1, Mat<C, R, T> const& mat2, T sca) {
+  Mat<C, R, T> const kSum = mat1 + mat2;
+  Mat<C, R, T> const kDiff = mat1 - mat2;
+  Mat<C, R, T> const kNeg = -mat1;
+  Mat<C, R, T> const kScaled = mat1 * sca;
+  Mat<C, R, T> const kShifted = sca - mat2;
+  for (usize col = 0; col < C; ++col) {
+    for (usize row = 0; row < R; ++row) {
+      EXPECT_EQ(kSum[col][row], static_cast<T>(mat1[col][row] + mat2[col][row])) << col << ", " << row;
+      EXPECT_EQ(kDiff[col][row], static_cast<T>(mat1[col][row] - mat2[col][row])) << col << ", " << row;
+      EXPECT_EQ(kNeg[col][row], static_cast<T>(-mat1[col][row])) << col << ", " << row;
+      EXPECT_EQ(kScaled[col][row], static_cast<T>(mat1[col][row] * sca)) << col << ", " << row;
+      EXPECT_EQ(kShifted[col][row], static_cast<T>(sca - mat2[col][row])) << col << ", " << row;
+    }
+  }
+  EXPECT_EQ(mat1 + sca, sca + mat1);
+  EXPECT_EQ(mat1 * sca, sca * mat1);
+  EXPECT_EQ(mat1 - sca, -(sca - mat1));
+}
+
+// Constant evaluation keeps the scalar loops.
+static_assert(Vec<5, i32>(1, 2, 3, 4, 5) + Vec<5, i32>(5, 4, 3, 2, 1) == Vec<5, i32>::Fill(6));
+static_assert(-(Vec<6, i32>::Fill(2) * 3) == Vec<6, i32>::Fill(-6));
+static_assert((Mat<2, 5, i32>(Vec<5, i32>::Fill(1), Vec<5, i32>::Fill(2)) * 4)[1] == Vec<5, i32>::Fill(8));
+
+}  // namespace
+
+TEST(SimdTest, PortableVec) {
+  ExpectVecOps(MakeVec<5, f32>(0.37F, 1.13F), MakeVec<5, f32>(-2.5F, 0.71F), 0.3F);
+  ExpectVecOps(MakeVec<7, f64>(0.37, 1.13), MakeVec<7, f64>(-2.5, 0.71), 0.3);
+  // 40 lanes exceed the widest fixed-size pack and leave a narrower tail.
+  ExpectVecOps(MakeVec<40, f32>(-9.1F, 0.47F), MakeVec<40, f32>(3.3F, -0.19F), -1.7F);
+  ExpectVecOps(MakeVec<9, i32>(-40, 11), MakeVec<9, i32>(7, 3), 5);
+  ExpectVecOps(MakeVec<6, i16>(-40, 11), MakeVec<6, i16>(7, 3), static_cast<i16>(5));
+}
+
+TEST(SimdTest, PortableMat) {
+  ExpectMatOps(MakeMat<3, 3, f32>(0.37F, 1.13F), MakeMat<3, 3, f32>(-2.5F, 0.71F), 0.3F);
+  ExpectMatOps(MakeMat<2, 5, f32>(0.37F, 1.13F), MakeMat<2, 5, f32>(-2.5F, 0.71F), 0.3F);
+  ExpectMatOps(MakeMat<4, 4, f32>(0.37F, 1.13F), MakeMat<4, 4, f32>(-2.5F, 0.71F), 0.3F);
+  // 64 elements, two full packs.
+  ExpectMatOps(MakeMat<8, 8, f64>(0.37, 1.13), MakeMat<8, 8, f64>(-2.5, 0.71), 0.3);
+  ExpectMatOps(MakeMat<3, 4, i32>(-40, 11), MakeMat<3, 4, i32>(7, 3), 5);
+
+  // Products go through the Vec overloads and keep the scalar fold.
+  Mat<3, 5, f32> const kMat = MakeMat<3, 5, f32>(0.5F, 0.25F);
+  Vec<3, f32> const kVec(1.5F, -2.0F, 0.75F);
+  Vec<5, f32> expected;
+  for (usize row = 0; row < 5; ++row) expected[row] = kMat[0][row] * kVec[0] + (kMat[1][row] * kVec[1] + kMat[2][row] * kVec[2]);
+  EXPECT_EQ(kMat * kVec, expected);
+}
+
+#ifdef TRANSFORM_SIMD_SSE
+
+// The intrinsic Vec4 and Mat4 kernels against a reference written on std::experimental::simd.
+TEST(SimdTest, PortableCrossCheck) {
+  using Pack = stdx::fixed_size_simd<f32, 4>;
+  auto const kLoad = [](Vec4<f32> const& vec) { return Pack(vec.data(), stdx::element_aligned); };
+  auto const kStore = [](Pack const& pack) { Vec4<f32> result; pack.copy_to(result.data(), stdx::element_aligned); return result; };
+
+  Vec4<f32> const kVecA(1.5F, -2.25F, 3.0F, 0.1F);
+  Vec4<f32> const kVecB(-0.3F, 4.0F, 7.5F, -1.0F);
+  EXPECT_EQ(kVecA + kVecB, kStore(kLoad(kVecA) + kLoad(kVecB)));
+  EXPECT_EQ(kVecA - kVecB, kStore(kLoad(kVecA) - kLoad(kVecB)));
+  EXPECT_EQ(kVecA * kVecB, kStore(kLoad(kVecA) * kLoad(kVecB)));
+  EXPECT_EQ(kVecA / kVecB, kStore(kLoad(kVecA) / kLoad(kVecB)));
+  EXPECT_EQ(-kVecA, kStore(-kLoad(kVecA)));
+
+  // Mat4 * Vec4 as the right fold over the columns. FMA kernels only stay close.
+  Mat4<f32> const kMat = MakeMat<4, 4, f32>(0.53F, -0.29F);
+  Pack reference = kLoad(kMat[3]) * kVecA[3];
+  for (usize idx = 3; idx-- > 0;) reference = kLoad(kMat[idx]) * kVecA[idx] + reference;
+#ifdef TRANSFORM_SIMD_AVX2
+  for (usize idx = 0; idx < 4; ++idx) EXPECT_NEAR((kMat * kVecA)[idx], kStore(reference)[idx], 1e-5F) << idx;
+#else
+  EXPECT_EQ(kMat * kVecA, kStore(reference));
+#endif
+}
+
+#endif  // TRANSFORM_SIMD_SSE
+
+#endif  // TRANSFORM_SIMD_PORTABLE_STDX
+
+}  // namespace tf::test
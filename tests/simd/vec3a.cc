@@ -0,0 +1,97 @@
+// Exercise the SIMD overloads even when the rest of the tests build without the backend.
+#ifndef TRANSFORM_SIMD
+#define TRANSFORM_SIMD
+#endif
+
+#include <cmath>
+
+#include <transform/mat/matcxr.h>
+#include <transform/simd/vec3a.h>
+#include <transform/transform/basic.h>
+#include <transform/vec/func.h>
+#include <transform/vec/vec3a.h>
+
+#include <gtest/gtest.h>
+
+namespace tf::test {
+
+#ifdef TRANSFORM_SIMD_SSE
+
+namespace {
+
+// With FMA the compiler may contract the scalar templates, so they agree with the registers to rounding only.
+void ExpectSame(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2) {
+#ifdef __FMA__
+  for (usize com = 0; com < 3; ++com) EXPECT_NEAR(vec1[com], vec2[com], 1e-5F) << com;
+#else
+  EXPECT_EQ(vec1, vec2);
+#endif
+  EXPECT_EQ(vec1.data()[3], vec2.data()[3]);
+}
+void ExpectSame(f32 sca1, f32 sca2) {
+#ifdef __FMA__
+  EXPECT_NEAR(sca1, sca2, 1e-5F);
+#else
+  EXPECT_EQ(sca1, sca2);
+#endif
+}
+
+}  // namespace
+
+TEST(SimdTest, Vec3A) {
+  Vec3A<f32> const kVecA(1.5F, -2.25F, 3.0F);
+  Vec3A<f32> const kVecB(-0.3F, 4.0F, 7.5F);
+  f32 const kSca = 0.7F;
+
+  // The SIMD overloads match the scalar templates, padding lane included.
+  ExpectSame(-kVecA, operator-<f32>(kVecA));
+  Vec3A<f32> const kZero(0.0F, -0.0F, 2.0F);
+  EXPECT_TRUE(std::signbit((-kZero).x()));
+  EXPECT_FALSE(std::signbit((-kZero).y()));
+  EXPECT_TRUE(std::signbit(operator-<f32>(kZero).x()));
+  ExpectSame(kVecA + kVecB, operator+<f32>(kVecA, kVecB));
+  ExpectSame(kVecA - kVecB, operator-<f32>(kVecA, kVecB));
+  ExpectSame(kVecA * kVecB, operator*<f32>(kVecA, kVecB));
+  ExpectSame(kVecA / kVecB, operator/<f32>(kVecA, kVecB));
+  ExpectSame(kVecA + kSca, operator+<f32>(kVecA, kSca));
+  ExpectSame(kVecA / kSca, operator/<f32>(kVecA, kSca));
+  ExpectSame(kSca - kVecA, operator-<f32>(kSca, kVecA));
+  ExpectSame(kSca / kVecA, operator/<f32>(kSca, kVecA));
+  ExpectSame(Cross(kVecA, kVecB), Cross<f32>(kVecA, kVecB));
+  ExpectSame(Dot(kVecA, kVecB), Dot<f32>(kVecA, kVecB));
+  ExpectSame(Length(kVecA), Length<f32>(kVecA));
+  ExpectSame(Normalize(kVecA), Normalize<f32>(kVecA));
+  ExpectSame(Normalize<Exact>(kVecA), Normalize<f32>(kVecA));
+
+  Mat4<f32> const kMat = Translate(1.0F, 2.0F, 3.0F) * RotateX(0.4F) * Scale(2.0F, 0.5F, 1.5F);
+  ExpectSame(kMat * kVecA, operator*<f32>(kMat, kVecA));
+
+  Vec3A<f32> vec = kVecA;
+  vec += kVecB;
+  vec *= kSca;
+  vec -= kSca;
+  vec /= kVecB;
+  ExpectSame(vec, ((kVecA + kVecB) * kSca - kSca) / kVecB);
+
+  // The padding is ignored, and a projective w or a dirty pad never leaks into Cross or Mat4 * Vec3A.
+  Vec3A<f32> padded = kVecA + 1.0F;
+  EXPECT_NE(padded.data()[3], 0.0F);
+  EXPECT_TRUE(padded - 1.0F == kVecA);
+  EXPECT_EQ(Dot(padded, kVecB), Dot<f32>(padded, kVecB));
+  EXPECT_EQ(Cross(padded, padded).data()[3], 0.0F);
+  Mat4<f32> projection = Mat4<f32>::Identity();
+  projection[2][3] = -1.0F;
+  EXPECT_EQ((projection * padded).data()[3], 0.0F);
+  EXPECT_EQ((projection * padded).xyz(), padded.xyz());
+
+  // The reciprocal square root estimate with one Newton-Raphson step.
+  for (usize com = 0; com < 3; ++com) EXPECT_NEAR(Normalize<Fast>(kVecA)[com], Normalize(kVecA)[com], 1e-6F) << com;
+  EXPECT_NEAR(Length<Fast>(kVecA), Length(kVecA), 1e-5F);
+
+  static_assert(Cross(Vec3A<f32>(1.0F, 0.0F, 0.0F), Vec3A<f32>(0.0F, 1.0F, 0.0F)) == Vec3A<f32>(0.0F, 0.0F, 1.0F));
+  static_assert(Normalize<Fast>(Vec3A<f32>(0.0F, 3.0F, 0.0F)) == Vec3A<f32>(0.0F, 1.0F, 0.0F));
+}
+
+#endif  // TRANSFORM_SIMD_SSE
+
+}  // namespace tf::test
@@ -0,0 +1,117 @@
+// Exercise the SIMD overloads even when the rest of the tests build without the backend.
+#ifndef TRANSFORM_SIMD
+#define TRANSFORM_SIMD
+#endif
+
+#include <cmath>
+#include <span>
+#include <vector>
+
+#include <transform/simd/vec4.h>
+#include <transform/vec/func.h>
+#include <transform/vec/vec4.h>
+
+#include <gtest/gtest.h>
+
+namespace tf::test {
+
+#ifdef TRANSFORM_SIMD_SSE
+
+TEST(SimdTest, Vec4) {
+  Vec4<f32> const kVecA(1.5F, -2.25F, 3.0F, 0.1F);
+  Vec4<f32> const kVecB(-0.3F, 4.0F, 7.5F, -1.0F);
+  f32 const kSca = 0.7F;
+
+  // The SIMD overloads match the scalar templates bit for bit.
+  EXPECT_EQ(-kVecA, operator-<f32>(kVecA));
+  EXPECT_EQ(kVecA + kVecB, operator+<f32>(kVecA, kVecB));
+  EXPECT_EQ(kVecA - kVecB, operator-<f32>(kVecA, kVecB));
+  EXPECT_EQ(kVecA * kVecB, operator*<f32>(kVecA, kVecB));
+  EXPECT_EQ(kVecA / kVecB, operator/<f32>(kVecA, kVecB));
+  EXPECT_EQ(kVecA + kSca, operator+<f32>(kVecA, kSca));
+  EXPECT_EQ(kVecA - kSca, operator-<f32>(kVecA, kSca));
+  EXPECT_EQ(kVecA * kSca, operator*<f32>(kVecA, kSca));
+  EXPECT_EQ(kVecA / kSca, operator/<f32>(kVecA, kSca));
+  EXPECT_EQ(kSca + kVecA, operator+<f32>(kSca, kVecA));
+  EXPECT_EQ(kSca - kVecA, operator-<f32>(kSca, kVecA));
+  EXPECT_EQ(kSca * kVecA, operator*<f32>(kSca, kVecA));
+  EXPECT_EQ(kSca / kVecA, operator/<f32>(kSca, kVecA));
+  EXPECT_EQ(Dot(kVecA, kVecB), (Dot<4, f32>(kVecA, kVecB)));
+  EXPECT_EQ(Length(kVecA), (Length<4, f32>(kVecA)));
+  EXPECT_EQ(Normalize(kVecA), (Normalize<4, f32>(kVecA)));
+
+  Vec4<f32> vec = kVecA;
+  vec += kVecB;
+  vec *= kSca;
+  vec -= kSca;
+  vec /= kVecB;
+  EXPECT_EQ(vec, ((kVecA + kVecB) * kSca - kSca) / kVecB);
+
+  EXPECT_TRUE(kVecA == Vec4<f32>(1.5F, -2.25F, 3.0F, 0.1F));
+  EXPECT_TRUE(kVecA != kVecB);
+  EXPECT_TRUE(Vec4<f32>(0.0F) == Vec4<f32>(-0.0F));
+}
+
+TEST(SimdTest, Vec4Fast) {
+  std::vector<Vec4<f32>> vecs(37);
+  for (usize idx = 0; idx < vecs.size(); ++idx) {
+    f32 const kSeed = static_cast<f32>(idx) + 0.25F;
+    vecs[idx]       = Vec4<f32>(std::sin(kSeed), std::cos(kSeed * 1.3F), std::sin(kSeed * 0.7F), 0.5F) * (kSeed * kSeed);
+  }
+
+  // Four at a time through the transpose, then the tail one by one; without FMA the exact
+  // policy keeps the scalar evaluation order.
+  std::vector<Vec4<f32>> exact = vecs;
+  std::vector<Vec4<f32>> fast  = vecs;
+  NormalizeAll(std::span(exact));
+  NormalizeAll<Fast>(std::span(fast));
+  for (usize idx = 0; idx < vecs.size(); ++idx) {
+#ifdef TRANSFORM_SIMD_AVX2
+    for (usize com = 0; com < 4; ++com) EXPECT_NEAR(exact[idx][com], (Normalize<4, f32>(vecs[idx]))[com], 1e-6F) << idx;
+#else
+    EXPECT_EQ(exact[idx], (Normalize<4, f32>(vecs[idx]))) << idx;
+#endif
+    for (usize com = 0; com < 4; ++com) {
+      EXPECT_NEAR(fast[idx][com], exact[idx][com], 1e-6F) << idx;
+      EXPECT_NEAR(Normalize<Fast>(vecs[idx])[com], exact[idx][com], 1e-6F) << idx;
+    }
+  }
+
+  EXPECT_EQ(simd::SqrtFast(0.0F), 0.0F);
+  EXPECT_NEAR(simd::SqrtFast(16.0F), 4.0F, 4e-6F);
+  EXPECT_NEAR(simd::InverseSqrtFast(2.0F), 0.70710678F, 1e-6F);
+}
+
+TEST(SimdTest, Vec4Mask) {
+  Vec4<f32> const kVecA(1.5F, -2.25F, std::nanf(""), 0.1F);
+  Vec4<f32> const kVecB(1.5F,  4.0F,  7.5F,        -1.0F);
+
+  // Packed compares keep the scalar NaN semantics: only != holds.
+  EXPECT_EQ(kVecA <  kVecB, operator< <f32>(kVecA, kVecB));
+  EXPECT_EQ(kVecA <= kVecB, operator<=<f32>(kVecA, kVecB));
+  EXPECT_EQ(kVecA >  kVecB, operator> <f32>(kVecA, kVecB));
+  EXPECT_EQ(kVecA >= kVecB, operator>=<f32>(kVecA, kVecB));
+  EXPECT_EQ(kVecA <  0.5F, operator< <f32>(kVecA, 0.5F));
+  EXPECT_EQ(kVecA >= 0.5F, operator>=<f32>(kVecA, 0.5F));
+  EXPECT_EQ(Equal   (kVecA, kVecB), (Equal   <4, f32>(kVecA, kVecB)));
+  EXPECT_EQ(NotEqual(kVecA, kVecB), (NotEqual<4, f32>(kVecA, kVecB)));
+  EXPECT_EQ(Bitmask(NotEqual(kVecA, kVecB)), 0b1110U);
+
+  Vec4<bool> const kMask(true, false, false, true);
+  EXPECT_EQ(Select(kMask, kVecB, -kVecB), Vec4<f32>(1.5F, -4.0F, -7.5F, -1.0F));
+  EXPECT_EQ(Select(kMask, kVecB, -kVecB), (Select<4, f32>(kMask, kVecB, -kVecB)));
+}
+
+TEST(SimdTest, Vec4Constexpr) {
+  Vec4<f32> constexpr kVecA(1.0F, 2.0F, 3.0F, 4.0F);
+  Vec4<f32> constexpr kVecB(4.0F, 3.0F, 2.0F, 1.0F);
+
+  static_assert(kVecA + kVecB == Vec4<f32>(5.0F, 5.0F, 5.0F, 5.0F));
+  static_assert(kVecA * 2.0F - kVecB == Vec4<f32>(-2.0F, 1.0F, 4.0F, 7.0F));
+  static_assert(Dot(kVecA, kVecB) == 20.0F);
+  static_assert(-kVecA != kVecA);
+}
+
+#endif  // TRANSFORM_SIMD_SSE
+
+}  // namespace tf::test
@@ -0,0 +1,63 @@
+// Exercise the SIMD overloads even when the rest of the tests build without the backend.
+#ifndef TRANSFORM_SIMD
+#define TRANSFORM_SIMD
+#endif
+
+#include <transform/simd/vec4d.h>
+#include <transform/vec/func.h>
+#include <transform/vec/vec4.h>
+
+#include <gtest/gtest.h>
+#include <tests/util.h>
+
+namespace tf::test {
+
+#ifdef TRANSFORM_SIMD_AVX
+
+TEST(SimdTest, Vec4d) {
+  if (!HostSupportsTarget()) GTEST_SKIP() << "No AVX on this host";
+
+  Vec4<f64> const kVecA(1.5, -2.25, 3.0, 0.1);
+  Vec4<f64> const kVecB(-0.3, 4.0, 7.5, -1.0);
+  f64 const kSca = 0.7;
+
+  // The SIMD overloads match the scalar templates bit for bit.
+  EXPECT_EQ(-kVecA, operator-<f64>(kVecA));
+  EXPECT_EQ(kVecA + kVecB, operator+<f64>(kVecA, kVecB));
+  EXPECT_EQ(kVecA - kVecB, operator-<f64>(kVecA, kVecB));
+  EXPECT_EQ(kVecA * kVecB, operator*<f64>(kVecA, kVecB));
+  EXPECT_EQ(kVecA / kVecB, operator/<f64>(kVecA, kVecB));
+  EXPECT_EQ(kVecA + kSca, operator+<f64>(kVecA, kSca));
+  EXPECT_EQ(kVecA - kSca, operator-<f64>(kVecA, kSca));
+  EXPECT_EQ(kVecA * kSca, operator*<f64>(kVecA, kSca));
+  EXPECT_EQ(kVecA / kSca, operator/<f64>(kVecA, kSca));
+  EXPECT_EQ(kSca + kVecA, operator+<f64>(kSca, kVecA));
+  EXPECT_EQ(kSca - kVecA, operator-<f64>(kSca, kVecA));
+  EXPECT_EQ(kSca * kVecA, operator*<f64>(kSca, kVecA));
+  EXPECT_EQ(kSca / kVecA, operator/<f64>(kSca, kVecA));
+  EXPECT_EQ(Dot(kVecA, kVecB), (Dot<4, f64>(kVecA, kVecB)));
+  EXPECT_EQ(Length(kVecA), (Length<4, f64>(kVecA)));
+  EXPECT_EQ(Normalize(kVecA), (Normalize<4, f64>(kVecA)));
+
+  Vec4<f64> vec = kVecA;
+  vec += kVecB;
+  vec *= kSca;
+  vec -= kSca;
+  vec /= kVecB;
+  EXPECT_EQ(vec, ((kVecA + kVecB) * kSca - kSca) / kVecB);
+
+  EXPECT_TRUE(kVecA != kVecB);
+  EXPECT_TRUE(Vec4<f64>(0.0) == Vec4<f64>(-0.0));
+}
+
+TEST(SimdTest, Vec4dConstexpr) {
+  Vec4<f64> constexpr kVecA(1.0, 2.0, 3.0, 4.0);
+  Vec4<f64> constexpr kVecB(4.0, 3.0, 2.0, 1.0);
+
+  static_assert(kVecA + kVecB == Vec4<f64>(5.0, 5.0, 5.0, 5.0));
+  static_assert(Dot(kVecA, kVecB) == 20.0);
+}
+
+#endif  // TRANSFORM_SIMD_AVX
+
+}  // namespace tf::test
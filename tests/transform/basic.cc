@@ -0,0 +1,210 @@
+#include <transform/mat/func.h>
+#include <transform/transform/basic.h>
+
+#include <array>
+#include <cmath>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <tests/util.h>
+
+namespace tf::test {
+
+namespace {
+
+// The SIMD Mat4 products contract to FMA on AVX2, so batched and single results agree to rounding.
+template <typename T> void ExpectNear(std::span<Vec3<T> const> vecs, auto reference, T eps) {
+  for (usize idx = 0; idx < vecs.size(); ++idx) {
+    Vec3<T> const kExpected = reference(idx);
+    for (usize com = 0; com < 3; ++com) EXPECT_NEAR(vecs[idx][com], kExpected[com], eps) << idx << ", " << com;
+  }
+}
+
+template <typename T> std::vector<Vec3<T>> MakePoints(usize count) {
+  std::vector<Vec3<T>> points;
+  for (usize idx = 0; idx < count; ++idx) {
+    T const arg = static_cast<T>(idx) * static_cast<T>(0.7);
+    points.emplace_back(std::sin(arg) * 4, std::cos(arg) - 1, arg - 3);
+  }
+  return points;
+}
+
+}  // namespace
+
+TEST(TransformTest, BasicInverse) {
+  Mat4<f64> const kRotate = RotateZ(0.3) * RotateX(-1.1) * RotateY(2.0);
+  Mat4<f64> const kRigid  = Translate(1.0, -2.0, 3.5) * kRotate;
+  Mat4<f64> const kAffine = Translate(1.0, -2.0, 3.5) * kRotate * Scale(2.0, 0.5, 3.0) * ShearXY(0.25);
+  Mat4<f64> const kView   = LookAt(Vec3<f64>(3, 4, 5), Vec3<f64>(0, 1, 0), Vec3<f64>(0, 0, 0));
+
+  EXPECT_TRUE(IsOrthogonal(kRotate));
+  EXPECT_TRUE(IsRigid(kRigid));
+  EXPECT_TRUE(IsRigid(kView));
+  EXPECT_TRUE(IsAffine(kAffine));
+  EXPECT_FALSE(IsRigid(kAffine));
+  EXPECT_FALSE(IsOrthogonal(kRigid));
+  EXPECT_FALSE(IsAffine(Mat4<f64>(1.0)));
+
+  ExpectNear(InverseOrthogonal(kRotate), Inverse(kRotate));
+  ExpectNear(InverseRigid(kRigid), Inverse(kRigid));
+  ExpectNear(InverseRigid(kView), Inverse(kView));
+  ExpectNear(InverseAffine(kRigid), Inverse(kRigid));
+  ExpectNear(InverseAffine(kAffine), Inverse(kAffine));
+  ExpectNear(InverseAffine(kAffine) * kAffine, Mat4<f64>::Identity());
+
+  static_assert(InverseAffine(Translate(1.0, 2.0, 3.0) * Scale(2.0)) == Scale(0.5) * Translate(-1.0, -2.0, -3.0));
+  static_assert(InverseRigid(Translate(1, 2, 3)) == Translate(-1, -2, -3));
+}
+
+TEST(TransformTest, BasicNormalMatrix) {
+  Mat4<f64> const kModel = Translate(1.0, -2.0, 3.5) * RotateX(0.7) * Scale(2.0, 0.5, -3.0) * ShearYZ(0.25);
+  Mat3<f64> const kInverseTranspose = Transpose(Inverse(Mat3<f64>::Embed(kModel)));
+
+  Mat3<f64> const kExact = NormalMatrix(kModel, true);
+  Mat3<f64> const kAdjugate = NormalMatrix(kModel);
+  f64 const kDet = Determinant(Mat3<f64>::Embed(kModel));
+  for (usize col = 0; col < 3; ++col) {
+    for (usize row = 0; row < 3; ++row) {
+      EXPECT_NEAR(kExact[col][row], kInverseTranspose[col][row], 1e-12) << col << ", " << row;
+      EXPECT_NEAR(kAdjugate[col][row], kDet * kInverseTranspose[col][row], 1e-12) << col << ", " << row;
+    }
+  }
+
+  // A normal stays perpendicular to a transformed tangent.
+  Vec3<f64> const kTangent(1, 2, 0);
+  Vec3<f64> const kNormal(2, -1, 5);
+  EXPECT_NEAR(Dot(Vec3<f64>(kModel * Vec4<f64>(kTangent, 0)), kAdjugate * kNormal), 0.0, 1e-12);
+
+  Mat4<f64> const kModels[] = {kModel, Scale(2.0), RotateY(1.0)};
+  Mat3<f64> normals[3];
+  NormalMatrix(kModels, normals);
+  for (usize idx = 0; idx < 3; ++idx) EXPECT_EQ(normals[idx], NormalMatrix(kModels[idx]));
+  std::vector<Mat3<f64>> exact(3);
+  NormalMatrix<f64>(kModels, exact, true);
+  NormalMatrix(std::vector<Mat4<f64>>{kModel}, std::span(exact).first(1), true);
+  EXPECT_EQ(exact[0], kExact);
+  for (usize idx = 0; idx < 3; ++idx) EXPECT_EQ(exact[idx], NormalMatrix(kModels[idx], true));
+
+  static_assert(NormalMatrix(Scale(2.0, 4.0, 8.0)) == Mat3<f64>(32, 0, 0, 0, 16, 0, 0, 0, 8));
+  static_assert(NormalMatrix(Scale(2.0, 4.0, 8.0), true) == Mat3<f64>(0.5, 0, 0, 0, 0.25, 0, 0, 0, 0.125));
+}
+
+TEST(TransformTest, BasicMultiplyAll) {
+  // Parent and local transforms of one hierarchy level, long enough for the prefetch distance and a ragged tail.
+  std::vector<Mat4<f32>> parents, locals;
+  for (usize idx = 0; idx < 37; ++idx) {
+    f32 const arg = static_cast<f32>(idx) * 0.3F;
+    parents.push_back(Translate(arg, 1.0F, -arg) * RotateZ(arg));
+    locals.push_back(RotateX(-arg) * Scale(1.0F + arg, 2.0F, 0.5F) * Translate(0.0F, arg, 2.0F));
+  }
+  std::vector<Mat4<f32>> world(parents.size()), view_model(parents.size());
+  Mat4<f32> const kView = LookAt(Vec3<f32>(3, 4, 5), Vec3<f32>(0, 1, 0), Vec3<f32>(0, 0, 0));
+  MultiplyAll(parents, locals, world);
+  MultiplyAll(kView, world, view_model);
+  for (usize idx = 0; idx < world.size(); ++idx) {
+    EXPECT_EQ(world[idx], parents[idx] * locals[idx]) << idx;
+    EXPECT_EQ(view_model[idx], kView * world[idx]) << idx;
+  }
+
+  // In place on either side.
+  std::vector<Mat4<f32>> in_place = locals;
+  MultiplyAll(parents, in_place, in_place);
+  EXPECT_EQ(in_place, world);
+  MultiplyAll(in_place[0], in_place, in_place);
+  EXPECT_EQ(in_place[5], world[0] * world[5]);
+
+  // Enough output to bypass the cache.
+  std::vector<Mat4<f32>> const kMany(usize{1} << 19, kView);
+  std::vector<Mat4<f32>> many_out(kMany.size());
+  MultiplyAll(parents[3], kMany, many_out);
+  EXPECT_EQ(many_out.front(), parents[3] * kView);
+  EXPECT_EQ(many_out.back(), parents[3] * kView);
+
+  std::vector<Mat4<f64>> const kParents(3, Translate(1.0, 2.0, 3.0));
+  std::vector<Mat4<f64>> const kLocals = {RotateX(0.5), Scale(2.0), ShearXY(0.25)};
+  std::vector<Mat4<f64>> world_d(3);
+  MultiplyAll(kParents, kLocals, world_d);
+  for (usize idx = 0; idx < 3; ++idx) EXPECT_EQ(world_d[idx], kParents[idx] * kLocals[idx]) << idx;
+  MultiplyAll<f64>(std::span(kParents).first(2), std::span(kLocals).last(2), std::span(world_d).last(2));
+  EXPECT_EQ(world_d[2], kParents[1] * kLocals[2]);
+
+  // Other containers on the broadcast form.
+  std::array<Mat4<f64>, 3> view_d{};
+  MultiplyAll(Translate(0.0, 0.0, -1.0), kLocals, view_d);
+  for (usize idx = 0; idx < 3; ++idx) EXPECT_EQ(view_d[idx], Translate(0.0, 0.0, -1.0) * kLocals[idx]) << idx;
+  std::array<Mat4<f32>, 2> const kRhs = {RotateZ(0.5F), Scale(3.0F)};
+  std::vector<Mat4<f32>> broadcast_out(kRhs.size());
+  MultiplyAll(kView, kRhs, broadcast_out);
+  EXPECT_EQ(broadcast_out[1], kView * kRhs[1]);
+
+  static_assert([] { Mat4<f64> mats[] = {Scale(2.0), Translate(1.0, 0.0, 0.0)}; MultiplyAll(Translate(0.0, 1.0, 0.0), mats, mats); return mats[1]; }() == Translate(1.0, 1.0, 0.0));
+  static_assert([] { Mat4<f64> mats[] = {Scale(2.0), Translate(1.0, 0.0, 0.0)}; MultiplyAll(mats, mats, mats); return mats[1]; }() == Translate(2.0, 0.0, 0.0));
+}
+
+TEST(TransformTest, BasicTransformPoints) {
+  Mat4<f64> const kModel = Translate(1.0, -2.0, 3.5) * RotateX(0.7) * Scale(2.0, 0.5, -3.0);
+  Mat4<f64> projection = Mat4<f64>::Identity();
+  projection[2][3] = -1;
+  projection[3][3] = 4;
+
+  // Long enough for full groups of four and a ragged tail.
+  std::vector<Vec3<f64>> const kPoints = MakePoints<f64>(37);
+  std::vector<Vec3<f64>> points(kPoints.size()), vecs(kPoints.size()), projected(kPoints.size());
+  TransformPoints(kModel, kPoints, points);
+  TransformVectors(kModel, kPoints, vecs);
+  TransformPointsProjective(projection * kModel, kPoints, projected);
+  ExpectNear<f64>(points, [&](usize idx) { return Vec3<f64>(kModel * Vec4<f64>(kPoints[idx], 1)); }, 1e-12);
+  ExpectNear<f64>(vecs, [&](usize idx) { return Vec3<f64>(kModel * Vec4<f64>(kPoints[idx], 0)); }, 1e-12);
+  ExpectNear<f64>(projected, [&](usize idx) { Vec4<f64> const kClip = projection * kModel * Vec4<f64>(kPoints[idx], 1); return Vec3<f64>(kClip) / kClip[3]; }, 1e-12);
+
+  // In place matches out of place.
+  std::vector<Vec3<f64>> in_place = kPoints;
+  TransformPoints(kModel, in_place);
+  EXPECT_EQ(in_place, points);
+
+  // The f32 overloads use the SIMD kernels when available.
+  Mat4<f32> const kModelF = Translate(1.0F, -2.0F, 3.5F) * RotateZ(0.3F) * Scale(2.0F);
+  std::vector<Vec3<f32>> points_f = MakePoints<f32>(37);
+  std::vector<Vec3<f32>> const kPointsF = points_f;
+  std::vector<Vec3<f32>> vecs_f(points_f.size());
+  TransformVectors(kModelF, kPointsF, vecs_f);
+  TransformPoints(kModelF, points_f);
+  ExpectNear<f32>(points_f, [&](usize idx) { return Vec3<f32>(kModelF * Vec4<f32>(kPointsF[idx], 1)); }, 1e-5F);
+  ExpectNear<f32>(vecs_f, [&](usize idx) { return Vec3<f32>(kModelF * Vec4<f32>(kPointsF[idx], 0)); }, 1e-5F);
+
+  static_assert([] { Vec3<f64> points[] = {Vec3<f64>(1, 2, 3)}; TransformPoints(Translate(1.0, 2.0, 3.0), std::span(points)); return points[0]; }() == Vec3<f64>(2, 4, 6));
+}
+
+TEST(TransformTest, BasicTransformNormals) {
+  Mat4<f64> const kModel = Translate(1.0, -2.0, 3.5) * RotateX(0.7) * Scale(2.0, 0.5, -3.0) * ShearYZ(0.25);
+  Mat3<f64> const kInverseTranspose = Transpose(Inverse(Mat3<f64>::Embed(kModel)));
+
+  std::vector<Vec3<f64>> const kNormals = MakePoints<f64>(37);
+  std::vector<Vec3<f64>> unit(kNormals.size()), exact(kNormals.size());
+  TransformNormals(kModel, kNormals, unit);
+  TransformNormals(kModel, kNormals, exact, false);
+  ExpectNear<f64>(unit, [&](usize idx) { return Normalize(kInverseTranspose * kNormals[idx]); }, 1e-12);
+  ExpectNear<f64>(exact, [&](usize idx) { return kInverseTranspose * kNormals[idx]; }, 1e-12);
+
+  // A normal stays perpendicular to a transformed tangent.
+  std::vector<Vec3<f64>> tangents = {Vec3<f64>(1, 2, 0), Vec3<f64>(-3, 0.5, 4)};
+  std::vector<Vec3<f64>> normals  = {Vec3<f64>(2, -1, 5), Cross(Vec3<f64>(-3, 0.5, 4), Vec3<f64>(0, 1, 1))};
+  TransformVectors(kModel, tangents);
+  TransformNormals(kModel, normals);
+  for (usize idx = 0; idx < 2; ++idx) EXPECT_NEAR(Dot(tangents[idx], normals[idx]), 0.0, 1e-12) << idx;
+
+  // f32 through the SIMD kernels when available, exact and with the reciprocal square root estimate.
+  Mat4<f32> const kModelF = Translate(1.0F, -2.0F, 3.5F) * RotateZ(0.3F) * Scale(2.0F, 0.5F, 1.5F);
+  Mat3<f32> const kInverseTransposeF = Transpose(Inverse(Mat3<f32>::Embed(kModelF)));
+  std::vector<Vec3<f32>> const kNormalsF = MakePoints<f32>(37);
+  std::vector<Vec3<f32>> unit_f(kNormalsF.size()), fast_f = kNormalsF;
+  TransformNormals(kModelF, kNormalsF, unit_f);
+  TransformNormals<Fast>(kModelF, fast_f);
+  ExpectNear<f32>(unit_f, [&](usize idx) { return Normalize(kInverseTransposeF * kNormalsF[idx]); }, 1e-6F);
+  ExpectNear<f32>(fast_f, [&](usize idx) { return Normalize(kInverseTransposeF * kNormalsF[idx]); }, 1e-6F);
+
+  static_assert([] { Vec3<f64> normals[] = {Vec3<f64>(0, 0, 2)}; TransformNormals(Scale(1.0, 1.0, 4.0), std::span(normals), false); return normals[0]; }() == Vec3<f64>(0, 0, 0.5));
+}
+
+}  // namespace tf::test
@@ -0,0 +1,82 @@
+#ifndef TRANSFORM_TESTS_UTIL_H_
+#define TRANSFORM_TESTS_UTIL_H_
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <transform/mat/matcxr.h>
+#include <transform/types.h>
+#include <transform/vec/vec3.h>
+#include <transform/vec/vecn.h>
+
+#include <gtest/gtest.h>
+
+namespace tf::test {
+
+// Tolerance of the SIMD and kernel comparisons, which may reassociate or contract to FMA.
+template <typename T> inline constexpr T kNearEps = std::is_same_v<T, f32> ? static_cast<T>(1e-5) : static_cast<T>(1e-12);
+
+// Whether the host runs the instruction sets this file is compiled for. The SIMD tests are also built with -mavx or
+// -mavx2 -mfma, and each test of those binaries checks this first, so it skips rather than faults on older hosts.
+// MSVC only targets AVX through /arch for the whole build, so there is nothing to check there.
+inline bool HostSupportsTarget() {
+#if defined(__GNUC__)
+#ifdef __AVX__
+  if (!__builtin_cpu_supports("avx")) return false;
+#endif
+#ifdef __AVX2__
+  if (!__builtin_cpu_supports("avx2")) return false;
+#endif
+#ifdef __FMA__
+  if (!__builtin_cpu_supports("fma")) return false;
+#endif
+#endif
+  return true;
+}
+
+// Distinct, diagonally dominant (so invertible) entries; unrelated seeds give unrelated matrices.
+template <typename T> Mat4<T> MakeMat(T seed) {
+  Mat4<T> mat;
+  for (usize col = 0; col < 4; ++col)
+    for (usize row = 0; row < 4; ++row) mat[col][row] = std::sin(seed * static_cast<T>(4 * col + row + 1)) * static_cast<T>(3) + (col == row ? static_cast<T>(4) : T{});
+  return mat;
+}
+
+// `count` distinct Vec3 of moderate length, none of them zero.
+template <typename T> std::vector<Vec3<T>> MakeVecs(usize count, T seed) {
+  std::vector<Vec3<T>> vecs;
+  for (usize idx = 0; idx < count; ++idx) {
+    T const arg = seed + static_cast<T>(idx);
+    vecs.emplace_back(std::sin(arg) * static_cast<T>(3), std::cos(arg * static_cast<T>(1.7)) + static_cast<T>(0.5), std::sin(arg * static_cast<T>(0.3)) - static_cast<T>(2));
+  }
+  return vecs;
+}
+
+template <usize L, typename T> void ExpectNear(Vec<L, T> const& vec1, Vec<L, T> const& vec2, T eps = kNearEps<T>) {
+  for (usize idx = 0; idx < L; ++idx) EXPECT_NEAR(vec1[idx], vec2[idx], eps) << idx;
+}
+
+template <usize C, usize R, typename T> void ExpectNear(Mat<C, R, T> const& mat1, Mat<C, R, T> const& mat2, T eps = kNearEps<T>) {
+  for (usize col = 0; col < C; ++col)
+    for (usize row = 0; row < R; ++row) EXPECT_NEAR(mat1[col][row], mat2[col][row], eps) << col << ", " << row;
+}
+
+// A lane-wise batch (SoA, packets) against the same Vec function, which match exactly unless the compiler contracts
+// multiply-adds to FMA: it may fuse them differently in the two loops. Then the results are within a few ulps of the
+// products, `scale` bounding their size.
+template <typename V> void ExpectContracted(V const& batch, V const& single, f32 scale) {
+#ifdef __FMA__
+  f32 const eps = 4 * scale * std::numeric_limits<f32>::epsilon();
+  if constexpr (std::is_same_v<V, f32>) EXPECT_NEAR(batch, single, eps);
+  else for (usize com = 0; com < V::Length(); ++com) EXPECT_NEAR(batch[com], single[com], eps) << com;
+#else
+  static_cast<void>(scale);
+  EXPECT_EQ(batch, single);
+#endif
+}
+
+}  // namespace tf::test
+
+#endif  // TRANSFORM_TESTS_UTIL_H_
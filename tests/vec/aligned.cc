@@ -0,0 +1,39 @@
+#include <transform/vec/aligned.h>
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+#include <transform/vec/func.h>
+#include <transform/vec/vecn.h>
+
+namespace tf::test {
+
+TEST(VecTest, Aligned) {
+  Vec4<f32> constexpr kVec1(1.0F, 2.0F, 3.0F, 4.0F);
+  Vec4<f32> constexpr kVec2(2.0F, 4.0F, 6.0F, 8.0F);
+
+  static_assert(alignof(AlignedVec4<f32>) == 16);
+  static_assert(alignof(AlignedVec<4, f32, 32>) == 32);
+  static_assert(alignof(AlignedVec3<f32>) == 16 && sizeof(AlignedVec3<f32>) == 16);
+
+  AlignedVec4<f32> vecs[3] = {AlignedVec4<f32>(kVec1), AlignedVec4<f32>(1.0F, 2.0F, 3.0F, 4.0F), AlignedVec4<f32>()};
+
+  for (auto const& vec : vecs) EXPECT_EQ(reinterpret_cast<std::uintptr_t>(vec.data()) % 16, 0U);
+
+  EXPECT_EQ(vecs[0], kVec1);
+  EXPECT_EQ(vecs[1], kVec1);
+  EXPECT_EQ(vecs[2], Vec4<f32>());
+
+  vecs[2] = vecs[0] + vecs[1];
+  EXPECT_EQ(vecs[2], kVec2);
+
+  vecs[2] -= kVec1;
+  EXPECT_EQ(vecs[2].packed(), kVec1);
+  EXPECT_EQ(&vecs[2].packed(), static_cast<Vec4<f32> const*>(&vecs[2]));
+
+  Vec4<f32> const& packed = vecs[1];
+  EXPECT_EQ(packed.data(), vecs[1].data());
+  EXPECT_FLOAT_EQ(Dot(vecs[0], packed), 30.0F);
+}
+
+}  // namespace tf::test
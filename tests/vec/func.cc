@@ -1,10 +1,39 @@
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <span>
+#include <vector>
+
 #include <transform/vec/func.h>
+#include <transform/vec/vec4.h>
 #include <transform/vec/vecn.h>
 
 #include <gtest/gtest.h>
 
 namespace tf::test {
 
+namespace {
+
+// Distance in units in the last place between `val` and the f32 rounding of `ref`.
+u32 UlpError(f32 val, f64 ref) {
+  auto ordered = [](f32 sca) { i64 bits = std::bit_cast<i32>(sca); return bits < 0 ? -(bits & 0x7FFFFFFF) : bits; };
+  return static_cast<u32>(std::llabs(ordered(val) - ordered(static_cast<f32>(ref))));
+}
+
+// Components spread over [-1, 1] and magnitudes from 2^-20 to 2^20.
+std::vector<Vec4<f32>> MakeVecs(usize count) {
+  std::vector<Vec4<f32>> vecs(count);
+  for (usize idx = 0; idx < count; ++idx) {
+    f32 const kSeed  = static_cast<f32>(idx) + 0.5F;
+    f32 const kScale = std::exp2(std::sin(kSeed * 0.37F) * 20.0F);
+    vecs[idx]        = Vec4<f32>(std::sin(kSeed), std::cos(kSeed * 1.7F), std::sin(kSeed * 2.3F), std::cos(kSeed * 0.3F)) * kScale;
+  }
+  return vecs;
+}
+
+}  // namespace
+
 TEST(VecTest, Func) {
   Vec3<i32> constexpr kVecx(1, 0, 0);
   Vec3<i32> constexpr kVecy(0, 1, 0);
@@ -23,4 +52,85 @@ TEST(VecTest, Func) {
   EXPECT_EQ(Distance(kVecx * 3, kVecy * 4), 5);
 }
 
+TEST(VecTest, FuncMask) {
+  Vec4<f32> constexpr kVecA(1.0F, -2.0F, 3.0F, -4.0F);
+  Vec4<f32> constexpr kVecB(1.0F,  2.0F, 0.0F, -4.0F);
+
+  EXPECT_EQ(Equal   (kVecA, kVecB), Vec4<bool>( true, false, false,  true));
+  EXPECT_EQ(NotEqual(kVecA, kVecB), Vec4<bool>(false,  true,  true, false));
+  EXPECT_EQ(Bitmask(kVecA < 0.0F), 0b1010U);
+  EXPECT_EQ(Bitmask(Vec<6, bool>(true, false, false, false, false, true)), 0b100001U);
+  EXPECT_TRUE (Any(kVecA < kVecB));
+  EXPECT_FALSE(All(kVecA < kVecB));
+  EXPECT_TRUE (All(kVecA <= kVecA));
+  EXPECT_FALSE(Any(Vec4<bool>()));
+
+  // Branchless clamp and abs.
+  EXPECT_EQ(Select(kVecA > 2.0F, Vec4<f32>::Fill(2.0F), kVecA), Vec4<f32>(1.0F, -2.0F, 2.0F, -4.0F));
+  EXPECT_EQ(Select(kVecA < 0.0F, -kVecA, kVecA), Vec4<f32>(1.0F, 2.0F, 3.0F, 4.0F));
+
+  static_assert(Bitmask(Equal(kVecA, kVecB)) == 0b1001U);
+  static_assert(Select(kVecA < kVecB, kVecA, kVecB) == Vec4<f32>(1.0F, -2.0F, 0.0F, -4.0F));
+}
+
+TEST(VecTest, FuncSaturate) {
+  Vec4<u8> constexpr kPixA(200, 10, 255, 0);
+  Vec4<u8> constexpr kPixB(100, 20, 1, 0);
+
+  EXPECT_EQ(AddSat (kPixA, kPixB), Vec4<u8>(255, 30, 255, 0));
+  EXPECT_EQ(SubSat (kPixA, kPixB), Vec4<u8>(100, 0, 254, 0));
+  EXPECT_EQ(Average(kPixA, kPixB), Vec4<u8>(150, 15, 128, 0));
+
+  Vec<6, i16> constexpr kWordA(32000, -32000, 300, -1, 16384, -32768);
+  Vec<6, i16> constexpr kWordB( 1000,  -1000, 300,  1, 16384,     -1);
+  EXPECT_EQ(AddSat (kWordA, kWordB), (Vec<6, i16>(32767, -32768, 600, 0, 32767, -32768)));
+  EXPECT_EQ(SubSat (kWordA, kWordB), (Vec<6, i16>(31000, -31000, 0, -2, 0, -32767)));
+  EXPECT_EQ(MulHigh(kWordA, kWordB), (Vec<6, i16>(488, 488, 1, -1, 4096, 0)));
+  EXPECT_EQ(Average(kWordA, kWordB), (Vec<6, i16>(16500, -16500, 300, 0, 16384, -16384)));
+
+  // 32-bit lanes at the ends of their range.
+  Vec4<u32> constexpr kWideA(UINT32_MAX, UINT32_MAX, UINT32_MAX - 1, 1U << 16);
+  Vec4<u32> constexpr kWideB(UINT32_MAX,          2, UINT32_MAX,     1U << 16);
+  EXPECT_EQ(MulHigh(kWideA, kWideB), Vec4<u32>(UINT32_MAX - 1, 1, UINT32_MAX - 2, 1));
+  EXPECT_EQ(AddSat (kWideA, kWideB), Vec4<u32>(UINT32_MAX, UINT32_MAX, UINT32_MAX, 1U << 17));
+  EXPECT_EQ(Average(kWideA, kWideB), Vec4<u32>(UINT32_MAX, (1U << 31) + 1, UINT32_MAX, 1U << 16));
+  EXPECT_EQ(MulHigh(INT32_MIN, INT32_MIN), 1 << 30);
+  static_assert(MulHigh(UINT32_MAX, UINT32_MAX) == UINT32_MAX - 1);
+
+  // Narrowing clamps, widening is the converting constructor.
+  EXPECT_EQ(SaturateCast<u8>(kWordA), (Vec<6, u8>(255, 0, 255, 0, 255, 0)));
+  EXPECT_EQ(SaturateCast<i8>(Vec4<i32>(-1000, 127, 128, -5)), Vec4<i8>(-128, 127, 127, -5));
+  EXPECT_EQ(SaturateCast<u16>(Vec4<i64>(-1, 70000, 65535, 9)), Vec4<u16>(0, 65535, 65535, 9));
+  EXPECT_EQ(Vec4<i16>(kPixA), Vec4<i16>(200, 10, 255, 0));
+
+  static_assert(AddSat(u8{250}, u8{10}) == 255 && SubSat(u8{5}, u8{10}) == 0);
+  static_assert(AddSat(kPixA, kPixA) == Vec4<u8>(255, 20, 255, 0));
+}
+
+TEST(VecTest, FuncPolicy) {
+  std::vector<Vec4<f32>> const kVecs = MakeVecs(4099);
+
+  std::vector<Vec4<f32>> exact = kVecs;
+  std::vector<Vec4<f32>> fast  = kVecs;
+  NormalizeAll(std::span(exact));
+  NormalizeAll<Fast>(std::span(fast));
+  for (usize idx = 0; idx < kVecs.size(); ++idx) {
+    Vec4<f32> const& vec = kVecs[idx];
+    EXPECT_EQ(Length<Exact>(vec), Length(vec));
+    EXPECT_EQ(Normalize<Exact>(vec), Normalize(vec));
+
+    f64 const kLength = std::sqrt(static_cast<f64>(vec[0]) * vec[0] + static_cast<f64>(vec[1]) * vec[1] + static_cast<f64>(vec[2]) * vec[2] + static_cast<f64>(vec[3]) * vec[3]);
+    EXPECT_LE(UlpError(Length<Fast>(vec), kLength), kFastMaxUlp) << idx;
+    EXPECT_LE(UlpError(Distance<Fast>(vec, Vec4<f32>()), kLength), kFastMaxUlp) << idx;
+    for (usize com = 0; com < 4; ++com) {
+      EXPECT_LE(UlpError(Normalize<Fast>(vec)[com], vec[com] / kLength), kFastMaxUlp) << idx << ", " << com;
+      EXPECT_LE(UlpError(fast[idx][com], vec[com] / kLength), kFastMaxUlp) << idx << ", " << com;
+      EXPECT_NEAR(exact[idx][com], Normalize(vec)[com], 1e-6F) << idx << ", " << com;
+    }
+  }
+
+  EXPECT_EQ(Length<Fast>(Vec4<f32>()), 0.0F);
+  EXPECT_EQ(Normalize<Fast>(Vec3<f64>(0.0, -4.0, 0.0)), Vec3<f64>(0.0, -1.0, 0.0));
+}
+
 }  // namespace tf::test
@@ -0,0 +1,74 @@
+#include <transform/vec/packet.h>
+
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <tests/util.h>
+#include <transform/vec/func.h>
+#include <transform/vec/vec3.h>
+
+namespace tf::test {
+
+namespace {
+
+// Written once for a single Vec3 and reused unchanged for packets.
+template <typename V> constexpr V Reflect(V const& dir, V const& normal) { return dir - normal * (2 * Dot(dir, normal)); }
+template <typename V> constexpr V Shade(V const& dir, V const& vec) { return Normalize(Cross(dir, vec) + 0.5F * dir) / 3.0F - vec * 0.25F; }
+
+template <usize N> void ExpectPacketOps() {
+  std::vector<Vec3<f32>> const kDirs    = MakeVecs(N, 0.5F);
+  std::vector<Vec3<f32>> const kNormals = MakeVecs(N, 4.25F);
+  Packet<Vec3<f32>, N> const kDir    = LoadPacket<N>(std::span(kDirs));
+  Packet<Vec3<f32>, N> const kNormal = LoadPacket<N>(std::span(kNormals));
+
+  Packet<Vec3<f32>, N> const kReflected = Reflect(kDir, kNormal);
+  Packet<Vec3<f32>, N> const kShaded    = Shade(kDir, kNormal);
+  Packet<f32, N>       const kLength    = Length(kDir);
+  Packet<f32, N>       const kDistance  = Distance(kDir, kNormal);
+  for (usize idx = 0; idx < N; ++idx) {
+    SCOPED_TRACE(idx);
+    f32 const scale = Length(kDirs[idx]) * Dot(kNormals[idx], kNormals[idx]);
+    EXPECT_EQ(GetLane(kDir, idx), kDirs[idx]);
+    ExpectContracted(GetLane(kReflected, idx), Reflect(kDirs[idx], kNormals[idx]), scale);
+    ExpectContracted(GetLane(kShaded, idx), Shade(kDirs[idx], kNormals[idx]), scale);
+    ExpectContracted(kLength[idx], Length(kDirs[idx]), scale);
+    ExpectContracted(kDistance[idx], Distance(kDirs[idx], kNormals[idx]), scale);
+  }
+
+  // The stores themselves are exact.
+  std::vector<Vec3<f32>> out(N);
+  StorePacket(kReflected, std::span(out));
+  for (usize idx = 0; idx < N; ++idx) EXPECT_EQ(out[idx], GetLane(kReflected, idx)) << idx;
+}
+
+}  // namespace
+
+TEST(VecTest, Packet) {
+  ExpectPacketOps<4>();
+  ExpectPacketOps<8>();
+  ExpectPacketOps<16>();
+
+  // Broadcast, lanes and a short tail.
+  Vec3x4<f32> packet(Vec3<f32>(1.0F, 2.0F, 3.0F));
+  EXPECT_EQ(GetLane(packet, 3), Vec3<f32>(1.0F, 2.0F, 3.0F));
+  SetLane(packet, 1, Vec3<f32>(-1.0F, 0.0F, 4.0F));
+  EXPECT_EQ(GetLane(packet, 1), Vec3<f32>(-1.0F, 0.0F, 4.0F));
+  EXPECT_EQ(Dot(packet, packet)[1], 17.0F);
+
+  std::vector<Vec3<f32>> const kShort = {Vec3<f32>(1.0F, 2.0F, 3.0F), Vec3<f32>(4.0F, 5.0F, 6.0F)};
+  Vec3x8<f32> const kTail = LoadPacket<8>(std::span(kShort));
+  EXPECT_EQ(GetLane(kTail, 1), kShort[1]);
+  EXPECT_EQ(GetLane(kTail, 2), Vec3<f32>());
+  std::vector<Vec3<f32>> tail_out(2);
+  StorePacket(kTail * 2.0F, std::span(tail_out));
+  EXPECT_EQ(tail_out[1], Vec3<f32>(8.0F, 10.0F, 12.0F));
+
+  // Scalar packets and integer lanes.
+  Packet<f32, 8> const kWide = Packet<f32, 8>(2.0F) * 3 - 1.0F;
+  EXPECT_EQ(kWide, (Packet<f32, 8>(5.0F)));
+  EXPECT_NE(kWide, (Packet<f32, 8>(0.0F)));
+  static_assert(Dot(Vec<2, Wide<i32, 4>>(Wide<i32, 4>(3), Wide<i32, 4>(4)), Vec<2, Wide<i32, 4>>(Wide<i32, 4>(2), Wide<i32, 4>(-1))) == Wide<i32, 4>(2));
+}
+
+}  // namespace tf::test
@@ -0,0 +1,104 @@
+#include <transform/vec/soa.h>
+
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <tests/util.h>
+#include <transform/vec/func.h>
+#include <transform/vec/vec3.h>
+#include <transform/vec/vec4.h>
+
+namespace tf::test {
+
+namespace {
+
+// Long enough for full blocks and a ragged tail.
+constexpr usize kCount = 37;
+
+}  // namespace
+
+TEST(VecTest, Soa) {
+  std::vector<Vec3<f32>> const kVecsA = MakeVecs(kCount, 0.5F);
+  std::vector<Vec3<f32>> const kVecsB = MakeVecs(kCount, 4.25F);
+  Vec3Soa<f32> const kSoaA{std::span(kVecsA)};
+  Vec3Soa<f32> const kSoaB{std::span(kVecsB)};
+
+  ASSERT_EQ(kSoaA.size(), kCount);
+  EXPECT_EQ(Vec3Soa<f32>::Length(), 3U);
+  EXPECT_EQ(kSoaA[1].size(), kCount);
+  EXPECT_EQ(kSoaA[2][5], kVecsA[5][2]);
+  EXPECT_TRUE(Vec3Soa<f32>().empty());
+  for (usize idx = 0; idx < kCount; ++idx) EXPECT_EQ(kSoaA.Get(idx), kVecsA[idx]) << idx;
+
+  // Every lane matches the Vec operation exactly, up to FMA contraction where noted.
+  Vec3Soa<f32> const kSum     = kSoaA + kSoaB;
+  Vec3Soa<f32> const kDiff    = kSoaA - kSoaB;
+  Vec3Soa<f32> const kProd    = kSoaA * kSoaB;
+  Vec3Soa<f32> const kQuot    = kSoaA / kSoaB;
+  Vec3Soa<f32> const kScaled  = 2.5F * kSoaA;
+  Vec3Soa<f32> const kShifted = kSoaA - 0.75F;
+  Vec3Soa<f32> const kNeg     = -kSoaA;
+  Vec3Soa<f32> const kCross   = Cross(kSoaA, kSoaB);
+  Vec3Soa<f32> const kUnit    = Normalize(kSoaA);
+  std::vector<f32> const kDot = Dot(kSoaA, kSoaB);
+  std::vector<f32> const kLen = Length(kSoaA);
+  for (usize idx = 0; idx < kCount; ++idx) {
+    Vec3<f32> const& vec_a = kVecsA[idx];
+    Vec3<f32> const& vec_b = kVecsB[idx];
+    EXPECT_EQ(kSum.Get(idx), vec_a + vec_b) << idx;
+    EXPECT_EQ(kDiff.Get(idx), vec_a - vec_b) << idx;
+    EXPECT_EQ(kProd.Get(idx), vec_a * vec_b) << idx;
+    EXPECT_EQ(kQuot.Get(idx), vec_a / vec_b) << idx;
+    EXPECT_EQ(kScaled.Get(idx), 2.5F * vec_a) << idx;
+    EXPECT_EQ(kShifted.Get(idx), vec_a - 0.75F) << idx;
+    EXPECT_EQ(kNeg.Get(idx), -vec_a) << idx;
+    f32 const scale = Length(vec_a) * Length(vec_b);
+    SCOPED_TRACE(idx);
+    ExpectContracted(kCross.Get(idx), Cross(vec_a, vec_b), scale);
+    ExpectContracted(kUnit.Get(idx), Normalize(vec_a), 1.0F);
+    ExpectContracted(kDot[idx], Dot(vec_a, vec_b), scale);
+    ExpectContracted(kLen[idx], Length(vec_a), Length(vec_a));
+  }
+
+  // Particle update in place: pos += vel * dt, then a constant drift.
+  Vec3Soa<f32> pos = kSoaA;
+  pos.AddScaled(kSoaB, 0.016F);
+  pos += Vec3<f32>(0.0F, -9.81F, 0.0F);
+  pos *= 0.5F;
+  pos -= pos;
+  std::vector<Vec3<f32>> out(kCount, Vec3<f32>::Fill(1.0F));
+  pos.Store(std::span(out));
+  for (usize idx = 0; idx < kCount; ++idx) EXPECT_EQ(out[idx], Vec3<f32>()) << idx;
+
+  Vec3Soa<f32> moved = kSoaA;
+  moved.AddScaled(kSoaB, 0.016F);
+  moved.Store(std::span(out));
+  for (usize idx = 0; idx < kCount; ++idx) EXPECT_EQ(out[idx], kVecsA[idx] + kVecsB[idx] * 0.016F) << idx;
+
+  moved.Set(3, Vec3<f32>(1.0F, 2.0F, 3.0F));
+  EXPECT_EQ(moved.Get(3), Vec3<f32>(1.0F, 2.0F, 3.0F));
+  moved.resize(2);
+  EXPECT_EQ(moved.size(), 2U);
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+
+  // Four f32 components round trip, including the tail after the last group of four.
+  std::vector<Vec4<f32>> wide;
+  for (Vec3<f32> const& vec : kVecsA) wide.emplace_back(vec, vec[0] - vec[1]);
+  Vec4Soa<f32> const kWide{std::span<Vec4<f32> const>(wide)};
+  std::vector<Vec4<f32>> wide_out(kCount);
+  kWide.Store(std::span(wide_out));
+  EXPECT_EQ(wide_out, wide);
+  EXPECT_EQ(kWide[3][10], wide[10][3]);
+
+  // Integer lanes and four components.
+  std::vector<Vec4<i32>> const kInts = {Vec4<i32>(1, -2, 3, 40), Vec4<i32>(5, 6, -7, 8)};
+  Vec4Soa<i32> ints{std::span(kInts)};
+  ints *= Vec4<i32>(2, 3, 4, 5);
+  ints /= 2;
+  EXPECT_EQ(ints.Get(0), Vec4<i32>(1, -3, 6, 100));
+  EXPECT_EQ(Dot(ints, ints)[1], Dot(Vec4<i32>(5, 9, -14, 20), Vec4<i32>(5, 9, -14, 20)));
+}
+
+}  // namespace tf::test
@@ -111,6 +111,12 @@ TEST(VecTest, Vec1) {
   EXPECT_FALSE((kVect && kVecf).x());
   EXPECT_TRUE ((kVecf || kVect).x());
   EXPECT_FALSE((kVecf || kVecf).x());
+
+  EXPECT_TRUE ((kVec1 <  kVec2).x());
+  EXPECT_TRUE ((kVec2 <= kVec2).x());
+  EXPECT_FALSE((kVec1 >  2).x());
+  EXPECT_TRUE ((3 >= kVec3).x());
+  EXPECT_TRUE ((!kVecf).x());
 }
 
 }  // namespace tf::test
@@ -0,0 +1,94 @@
+#include <transform/vec/vec3a.h>
+
+#include <cmath>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+#include <transform/mat/matcxr.h>
+#include <transform/transform/basic.h>
+#include <transform/vec/func.h>
+
+namespace tf::test {
+
+TEST(VecTest, Vec3A) {
+  Vec3A<i32> constexpr kVec0{ };
+  Vec3A<i32> constexpr kVec1(1, 2,  4);
+  Vec3A<i32> constexpr kVec2(2, 4,  8);
+  Vec3A<i32> constexpr kVec3(3, 6, 12);
+
+  Vec3A<i32> vecn(kVec1);
+
+  EXPECT_EQ(vecn[0], 1);
+  EXPECT_EQ(vecn[1], 2);
+  EXPECT_EQ(vecn[2], 4);
+  EXPECT_EQ(vecn.data()[3], 0);
+
+  vecn.set_x(7);
+  vecn.set_y(8);
+  vecn.set_z(9);
+
+  EXPECT_EQ(vecn.x(), 7);
+  EXPECT_EQ(vecn.y(), 8);
+  EXPECT_EQ(vecn.z(), 9);
+
+  EXPECT_EQ(kVec1.xyz(), Vec3<i32>(1, 2, 4));
+  EXPECT_EQ(Vec3A<i32>(Vec3<i32>(1, 2, 4)), kVec1);
+
+  EXPECT_EQ(vecn = kVec1, kVec1);
+  EXPECT_EQ(vecn += 2, kVec1 + 2);
+  EXPECT_EQ(vecn -= 2, kVec1);
+  EXPECT_EQ(vecn *= 2, kVec2);
+  EXPECT_EQ(vecn /= 2, kVec1);
+
+  EXPECT_EQ(vecn += kVec2, kVec3);
+  EXPECT_EQ(vecn -= kVec2, kVec1);
+  EXPECT_EQ(vecn *= kVec2, Vec3A<i32>(2, 8, 32));
+  EXPECT_EQ(vecn /= kVec2, kVec1);
+
+  EXPECT_EQ(+kVec1, kVec1);
+  EXPECT_EQ(-kVec1, kVec0 - kVec1);
+  EXPECT_EQ(kVec1 + kVec2, kVec3);
+  EXPECT_EQ(kVec3 - kVec2, kVec1);
+  EXPECT_EQ(2 * kVec1, kVec2);
+  EXPECT_EQ(kVec2 / 2, kVec1);
+  EXPECT_EQ(8 / kVec2, Vec3A<i32>(4, 2, 1));
+  EXPECT_NE(kVec1, kVec2);
+
+  // The padding lane never takes part in comparisons or reductions.
+  EXPECT_EQ(kVec1 + 5 - 5, kVec1);
+  EXPECT_EQ(Dot(kVec1 + 1, kVec1), Dot(Vec3<i32>(2, 3, 5), Vec3<i32>(1, 2, 4)));
+
+  // Negation flips the sign of zero lanes too, like the scalar one.
+  Vec3A<f32> const kNegated = -Vec3A<f32>(0.0F, -0.0F, 1.0F);
+  EXPECT_TRUE(std::signbit(kNegated.x()));
+  EXPECT_FALSE(std::signbit(kNegated.y()));
+  EXPECT_EQ(kNegated.z(), -1.0F);
+}
+
+TEST(VecTest, Vec3AFunc) {
+  Vec3A<f32> constexpr kVecx(1.0F, 0.0F, 0.0F);
+  Vec3A<f32> constexpr kVecy(0.0F, 1.0F, 0.0F);
+  Vec3A<f32> constexpr kVecz(0.0F, 0.0F, 1.0F);
+
+  static_assert(sizeof(Vec3A<f32>) == 16 && alignof(Vec3A<f32>) == 16);
+
+  Vec3A<f32> vecs[2] = {kVecx, kVecy};
+  for (auto const& vec : vecs) EXPECT_EQ(reinterpret_cast<std::uintptr_t>(vec.data()) % 16, 0U);
+
+  EXPECT_EQ(Cross(kVecx, kVecy), kVecz);
+  EXPECT_FLOAT_EQ(Dot(kVecx, kVecy), 0.0F);
+  EXPECT_FLOAT_EQ(Length(kVecx * 2.0F), 2.0F);
+  EXPECT_EQ(Normalize(kVecz * 3.0F), kVecz);
+  EXPECT_FLOAT_EQ(Distance(kVecx * 3.0F, kVecy * 4.0F), 5.0F);
+
+  Vec3<f32> const vec1(1.0F, -2.0F, 3.0F);
+  Vec3<f32> const vec2(0.5F, 4.0F, -1.5F);
+  EXPECT_EQ(Cross(Vec3A<f32>(vec1), Vec3A<f32>(vec2)).xyz(), Cross(vec1, vec2));
+  EXPECT_FLOAT_EQ(Dot(Vec3A<f32>(vec1), Vec3A<f32>(vec2)), Dot(vec1, vec2));
+
+  Mat4<f32> const mat = Translate(1.0F, 2.0F, 3.0F) * Scale(2.0F);
+  Vec4<f32> const point = mat * Vec4<f32>(vec1, 1.0F);
+  EXPECT_EQ((mat * Vec3A<f32>(vec1)).xyz(), Vec3<f32>(point));
+}
+
+}  // namespace tf::test
@@ -19,6 +19,10 @@ TEST(VecTest, Vec4) {
   EXPECT_EQ(vecn[2], 0);
   EXPECT_EQ(vecn[3], 0);
 
+  EXPECT_EQ(kVec1.data(), &kVec1[0]);
+  EXPECT_EQ(kVec1.data() + 3, &kVec1[3]);
+  EXPECT_EQ(sizeof(Vec4<i32>), 4 * sizeof(i32));
+
   vecn.set_x(kVec1[0]);
   vecn.set_y(kVec1[1]);
   vecn.set_z(kVec1[2]);
@@ -173,6 +177,16 @@ TEST(VecTest, Vec4) {
   EXPECT_EQ(kVecftft || kVectttt, kVectttt);
   EXPECT_EQ(kVectftf || kVecffff, kVectftf);
   EXPECT_EQ(kVectftf || kVectttt, kVectttt);
+
+  Vec4<i32> constexpr kVecm(3, 2, 5, 8);
+
+  EXPECT_EQ(kVec1 <  kVecm, Vec4<bool>( true, false,  true, false));
+  EXPECT_EQ(kVec1 <= kVecm, Vec4<bool>( true,  true,  true,  true));
+  EXPECT_EQ(kVec1 >  kVecm, Vec4<bool>(false, false, false, false));
+  EXPECT_EQ(kVec1 >= kVecm, Vec4<bool>(false,  true, false,  true));
+  EXPECT_EQ(kVec1 <  4, kVecm <  4 && kVec1 < 3);
+  EXPECT_EQ(4 <= kVec2, kVec2 >= 4);
+  EXPECT_EQ(!kVecftft, kVectftf);
 }
 
 }  // namespace tf::test
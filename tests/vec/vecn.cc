@@ -25,6 +25,12 @@ TEST(VecTest, VecN) {
   EXPECT_EQ(vecn[4], 32);
   EXPECT_EQ(vecn[5],  0);
 
+  vecn.data()[5] = 64;
+
+  EXPECT_EQ(vecn[5], 64);
+  EXPECT_EQ(kVec1.data() + 5, &kVec1[5]);
+  EXPECT_EQ(sizeof(Vec6<i32>), 6 * sizeof(i32));
+
   EXPECT_EQ(vecn = kVec1, kVec1);
   EXPECT_EQ(vecn.head(), 1);
   EXPECT_EQ(vecn.tail(), Vec5<i32>(2, 4, 8, 16, 32));
@@ -123,8 +129,9 @@ TEST(VecTest, VecN) {
   EXPECT_EQ(1 &  kVec2, Vec6<i32>(1 &  kVec2.head(), 1 &  kVec2.tail()));
   EXPECT_EQ(1 |  kVec2, Vec6<i32>(1 |  kVec2.head(), 1 |  kVec2.tail()));
   EXPECT_EQ(1 ^  kVec2, Vec6<i32>(1 ^  kVec2.head(), 1 ^  kVec2.tail()));
-  EXPECT_EQ(1 << kVec2, Vec6<i32>(1 << kVec2.head(), 1 << kVec2.tail()));
-  EXPECT_EQ(1 >> kVec2, Vec6<i32>(1 >> kVec2.head(), 1 >> kVec2.tail()));
+  // Shift counts must stay below the width of i32.
+  EXPECT_EQ(1 << kVec4, Vec6<i32>(1 << kVec4.head(), 1 << kVec4.tail()));
+  EXPECT_EQ(1 >> kVec4, Vec6<i32>(1 >> kVec4.head(), 1 >> kVec4.tail()));
 
   EXPECT_EQ(kVec2 &  Vec1<i32>(1), kVec2 &  1);
   EXPECT_EQ(kVec2 |  Vec1<i32>(1), kVec2 |  1);
@@ -160,6 +167,16 @@ TEST(VecTest, VecN) {
   EXPECT_EQ(kVecftftft || kVectttttt, kVectttttt);
   EXPECT_EQ(kVectftftf || kVecffffff, kVectftftf);
   EXPECT_EQ(kVectftftf || kVectttttt, kVectttttt);
+
+  Vec6<i32> constexpr kVecm(2, 2, 8, 8, 32, 32);
+
+  EXPECT_EQ(kVec1 <  kVecm, kVectftftf);
+  EXPECT_EQ(kVec1 <= kVecm, kVectttttt);
+  EXPECT_EQ(kVec1 >  kVecm, kVecffffff);
+  EXPECT_EQ(kVec1 >= kVecm, kVecftftft);
+  EXPECT_EQ(kVec1 >  16, Vec6<bool>(false, false, false, false, false, true));
+  EXPECT_EQ(16 <= kVec1, kVec1 >= 16);
+  EXPECT_EQ(!kVecftftft, kVectftftf);
 }
 
 }  // namespace tf::test
@@ -0,0 +1,155 @@
+#include "transform/kernels/table.h"
+
+#include <cstring>
+
+#include <immintrin.h>
+
+#include "transform/types.h"
+
+namespace tf::kernels::detail {
+
+namespace {
+
+// Two Vec4 per register: each column is duplicated into both halves and the in-lane shuffles
+// splat the matching components of both vectors. FMA may differ from the scalar path in the last bit.
+inline __m256 MulColumns(__m256 col0, __m256 col1, __m256 col2, __m256 col3, __m256 vec) noexcept {
+  __m256 res = _mm256_mul_ps(col3, _mm256_shuffle_ps(vec, vec, _MM_SHUFFLE(3, 3, 3, 3)));
+  res        = _mm256_fmadd_ps(col2, _mm256_shuffle_ps(vec, vec, _MM_SHUFFLE(2, 2, 2, 2)), res);
+  res        = _mm256_fmadd_ps(col1, _mm256_shuffle_ps(vec, vec, _MM_SHUFFLE(1, 1, 1, 1)), res);
+  return       _mm256_fmadd_ps(col0, _mm256_shuffle_ps(vec, vec, _MM_SHUFFLE(0, 0, 0, 0)), res);
+}
+
+inline __m256 Broadcast(f32 const* src) noexcept { return _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(src)); }
+
+void Transform(f32 const* mat, f32 const* vecs, f32* out, usize count) noexcept {
+  __m256 col0 = Broadcast(mat + 0);
+  __m256 col1 = Broadcast(mat + 4);
+  __m256 col2 = Broadcast(mat + 8);
+  __m256 col3 = Broadcast(mat + 12);
+  usize  idx  = 0;
+  for (; idx + 8 <= 4 * count; idx += 8) _mm256_storeu_ps(out + idx, MulColumns(col0, col1, col2, col3, _mm256_loadu_ps(vecs + idx)));
+  if (idx < 4 * count) {
+    __m256 res = MulColumns(col0, col1, col2, col3, _mm256_castps128_ps256(_mm_loadu_ps(vecs + idx)));
+    _mm_storeu_ps(out + idx, _mm256_castps256_ps128(res));
+  }
+}
+
+// The AVX dot product works per 128-bit lane, so it normalizes two vectors at once.
+void Normalize(f32 const* vecs, f32* out, usize count) noexcept {
+  usize idx = 0;
+  for (; idx + 8 <= 4 * count; idx += 8) {
+    __m256 vec = _mm256_loadu_ps(vecs + idx);
+    _mm256_storeu_ps(out + idx, _mm256_div_ps(vec, _mm256_sqrt_ps(_mm256_dp_ps(vec, vec, 0xFF))));
+  }
+  if (idx < 4 * count) {
+    __m128 vec = _mm_loadu_ps(vecs + idx);
+    _mm_storeu_ps(out + idx, _mm_div_ps(vec, _mm_sqrt_ps(_mm_dp_ps(vec, vec, 0xFF))));
+  }
+}
+
+void Multiply(f32 const* lhs, f32 const* rhs, f32* out, usize count) noexcept {
+  for (usize mat = 0; mat < 16 * count; mat += 16) {
+    __m256 col0 = Broadcast(lhs + mat + 0);
+    __m256 col1 = Broadcast(lhs + mat + 4);
+    __m256 col2 = Broadcast(lhs + mat + 8);
+    __m256 col3 = Broadcast(lhs + mat + 12);
+    __m256 res0 = MulColumns(col0, col1, col2, col3, _mm256_loadu_ps(rhs + mat + 0));
+    __m256 res1 = MulColumns(col0, col1, col2, col3, _mm256_loadu_ps(rhs + mat + 8));
+    _mm256_storeu_ps(out + mat + 0, res0);
+    _mm256_storeu_ps(out + mat + 8, res1);
+  }
+}
+
+// Structure-of-arrays points, eight per register, with a masked load and store for the tail.
+template <bool kAffine> void TransformSoa(f32 const* mat, f32 const* xs, f32 const* ys, f32 const* zs, f32* out_xs, f32* out_ys, f32* out_zs, usize count) noexcept {
+  __m256 coef[12];
+  for (usize idx = 0; idx < (kAffine ? 12 : 9); ++idx) coef[idx] = _mm256_set1_ps(mat[idx]);
+  auto fold = [&coef](usize row, __m256 x, __m256 y, __m256 z) {
+    __m256 res = kAffine ? _mm256_fmadd_ps(coef[6 + row], z, coef[9 + row]) : _mm256_mul_ps(coef[6 + row], z);
+    res        = _mm256_fmadd_ps(coef[3 + row], y, res);
+    return       _mm256_fmadd_ps(coef[0 + row], x, res);
+  };
+  usize idx = 0;
+  for (; idx + 8 <= count; idx += 8) {
+    __m256 x = _mm256_loadu_ps(xs + idx);
+    __m256 y = _mm256_loadu_ps(ys + idx);
+    __m256 z = _mm256_loadu_ps(zs + idx);
+    _mm256_storeu_ps(out_xs + idx, fold(0, x, y, z));
+    _mm256_storeu_ps(out_ys + idx, fold(1, x, y, z));
+    _mm256_storeu_ps(out_zs + idx, fold(2, x, y, z));
+  }
+  if (idx < count) {
+    __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(count - idx)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    __m256  x    = _mm256_maskload_ps(xs + idx, mask);
+    __m256  y    = _mm256_maskload_ps(ys + idx, mask);
+    __m256  z    = _mm256_maskload_ps(zs + idx, mask);
+    _mm256_maskstore_ps(out_xs + idx, mask, fold(0, x, y, z));
+    _mm256_maskstore_ps(out_ys + idx, mask, fold(1, x, y, z));
+    _mm256_maskstore_ps(out_zs + idx, mask, fold(2, x, y, z));
+  }
+}
+
+// Integer lanes, one register per block, with the partial block staged through zero-filled stack copies.
+// AVX2 has no byte or word masked loads, and this keeps the tail on the vector operation.
+template <typename In, typename Out, usize kLanes, typename Op> void Blocks(In const* lhs, In const* rhs, Out* out, usize count, Op op) noexcept {
+  usize idx = 0;
+  for (; idx + kLanes <= count; idx += kLanes) op(lhs + idx, rhs + idx, out + idx);
+  if (idx == count) return;
+  In  lhs_tail[kLanes] = {};
+  In  rhs_tail[kLanes] = {};
+  Out out_tail[kLanes];
+  std::memcpy(lhs_tail, lhs + idx, (count - idx) * sizeof(In));
+  std::memcpy(rhs_tail, rhs + idx, (count - idx) * sizeof(In));
+  op(lhs_tail, rhs_tail, out_tail);
+  std::memcpy(out + idx, out_tail, (count - idx) * sizeof(Out));
+}
+
+template <typename T> inline __m256i Load (T const* src)          noexcept { return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(src)); }
+template <typename T> inline void    Store(T* dst, __m256i lanes) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), lanes); }
+
+template <typename T, typename Op> void Lanes(T const* lhs, T const* rhs, T* out, usize count, Op op) noexcept {
+  Blocks<T, T, 32 / sizeof(T)>(lhs, rhs, out, count, [op](T const* src1, T const* src2, T* dst) { Store(dst, op(Load(src1), Load(src2))); });
+}
+
+void AddSatU8  (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept { Lanes(lhs, rhs, out, count, [](__m256i reg1, __m256i reg2) { return _mm256_adds_epu8(reg1, reg2); }); }
+void SubSatU8  (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept { Lanes(lhs, rhs, out, count, [](__m256i reg1, __m256i reg2) { return _mm256_subs_epu8(reg1, reg2); }); }
+void AverageU8 (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept { Lanes(lhs, rhs, out, count, [](__m256i reg1, __m256i reg2) { return _mm256_avg_epu8(reg1, reg2); }); }
+void AddSatI16 (i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept { Lanes(lhs, rhs, out, count, [](__m256i reg1, __m256i reg2) { return _mm256_adds_epi16(reg1, reg2); }); }
+void SubSatI16 (i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept { Lanes(lhs, rhs, out, count, [](__m256i reg1, __m256i reg2) { return _mm256_subs_epi16(reg1, reg2); }); }
+void MulHighI16(i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept { Lanes(lhs, rhs, out, count, [](__m256i reg1, __m256i reg2) { return _mm256_mulhi_epi16(reg1, reg2); }); }
+
+// packus works within 128-bit lanes, so the quadwords are put back in order afterwards.
+void Pack(i16 const* src, u8* out, usize count) noexcept {
+  Blocks<i16, u8, 32>(src, src, out, count, [](i16 const* words, i16 const*, u8* bytes) {
+    Store(bytes, _mm256_permute4x64_epi64(_mm256_packus_epi16(Load(words), Load(words + 16)), _MM_SHUFFLE(3, 1, 2, 0)));
+  });
+}
+// Back to front, tail first, so that in place no block of words overwrites bytes not read yet (see kernels/sse4.cc).
+void Unpack(u8 const* src, i16* out, usize count) noexcept {
+  auto const unpack = [](u8 const* bytes, i16* words) {
+    __m256i lanes = Load(bytes);
+    Store(words + 0,  _mm256_cvtepu8_epi16(_mm256_castsi256_si128(lanes)));
+    Store(words + 16, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(lanes, 1)));
+  };
+  usize idx = count - count % 32;
+  if (idx != count) {
+    u8  bytes_tail[32] = {};
+    i16 words_tail[32];
+    std::memcpy(bytes_tail, src + idx, count - idx);
+    unpack(bytes_tail, words_tail);
+    std::memcpy(out + idx, words_tail, (count - idx) * sizeof(i16));
+  }
+  while (idx != 0) {
+    idx -= 32;
+    unpack(src + idx, out + idx);
+  }
+}
+
+}  // namespace
+
+Table const kAvx2Table = {
+    Transform, Normalize, Multiply, TransformSoa<false>, TransformSoa<true>,
+    AddSatU8, SubSatU8, AverageU8, AddSatI16, SubSatI16, MulHighI16, Pack, Unpack,
+};
+
+}  // namespace tf::kernels::detail
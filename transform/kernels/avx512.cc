@@ -0,0 +1,139 @@
+#include "transform/kernels/table.h"
+
+#include <immintrin.h>
+
+#include "transform/types.h"
+
+namespace tf::kernels::detail {
+
+namespace {
+
+// Four Vec4 per register, the AVX2 layout widened; partial batches use masked loads and stores.
+inline __m512 MulColumns(__m512 col0, __m512 col1, __m512 col2, __m512 col3, __m512 vec) noexcept {
+  __m512 res = _mm512_mul_ps(col3, _mm512_permute_ps(vec, _MM_SHUFFLE(3, 3, 3, 3)));
+  res        = _mm512_fmadd_ps(col2, _mm512_permute_ps(vec, _MM_SHUFFLE(2, 2, 2, 2)), res);
+  res        = _mm512_fmadd_ps(col1, _mm512_permute_ps(vec, _MM_SHUFFLE(1, 1, 1, 1)), res);
+  return       _mm512_fmadd_ps(col0, _mm512_permute_ps(vec, _MM_SHUFFLE(0, 0, 0, 0)), res);
+}
+
+inline __m512    Broadcast(f32 const* src) noexcept { return _mm512_broadcast_f32x4(_mm_loadu_ps(src)); }
+inline __mmask16 TailMask (usize count)    noexcept { return static_cast<__mmask16>((1U << (4 * count)) - 1); }
+
+// Squared length summed within each 128-bit lane, then divided out.
+inline __m512 Normalize(__m512 vec) noexcept {
+  __m512 sum = _mm512_mul_ps(vec, vec);
+  sum        = _mm512_add_ps(sum, _mm512_permute_ps(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+  sum        = _mm512_add_ps(sum, _mm512_permute_ps(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+  return _mm512_div_ps(vec, _mm512_sqrt_ps(sum));
+}
+
+void Transform(f32 const* mat, f32 const* vecs, f32* out, usize count) noexcept {
+  __m512 col0 = Broadcast(mat + 0);
+  __m512 col1 = Broadcast(mat + 4);
+  __m512 col2 = Broadcast(mat + 8);
+  __m512 col3 = Broadcast(mat + 12);
+  usize  idx  = 0;
+  for (; idx + 4 <= count; idx += 4) _mm512_storeu_ps(out + 4 * idx, MulColumns(col0, col1, col2, col3, _mm512_loadu_ps(vecs + 4 * idx)));
+  if (idx < count) {
+    __mmask16 mask = TailMask(count - idx);
+    _mm512_mask_storeu_ps(out + 4 * idx, mask, MulColumns(col0, col1, col2, col3, _mm512_maskz_loadu_ps(mask, vecs + 4 * idx)));
+  }
+}
+
+void Normalize(f32 const* vecs, f32* out, usize count) noexcept {
+  usize idx = 0;
+  for (; idx + 4 <= count; idx += 4) _mm512_storeu_ps(out + 4 * idx, Normalize(_mm512_loadu_ps(vecs + 4 * idx)));
+  if (idx < count) {
+    __mmask16 mask = TailMask(count - idx);
+    _mm512_mask_storeu_ps(out + 4 * idx, mask, Normalize(_mm512_maskz_loadu_ps(mask, vecs + 4 * idx)));
+  }
+}
+
+// A whole matrix per register: every lhs column is broadcast to all four lanes.
+void Multiply(f32 const* lhs, f32 const* rhs, f32* out, usize count) noexcept {
+  for (usize mat = 0; mat < 16 * count; mat += 16) {
+    __m512 col0 = Broadcast(lhs + mat + 0);
+    __m512 col1 = Broadcast(lhs + mat + 4);
+    __m512 col2 = Broadcast(lhs + mat + 8);
+    __m512 col3 = Broadcast(lhs + mat + 12);
+    _mm512_storeu_ps(out + mat, MulColumns(col0, col1, col2, col3, _mm512_loadu_ps(rhs + mat)));
+  }
+}
+
+// Structure-of-arrays points, sixteen per register; the tail reuses the loop body under a mask.
+template <bool kAffine> void TransformSoa(f32 const* mat, f32 const* xs, f32 const* ys, f32 const* zs, f32* out_xs, f32* out_ys, f32* out_zs, usize count) noexcept {
+  __m512 coef[12];
+  for (usize idx = 0; idx < (kAffine ? 12 : 9); ++idx) coef[idx] = _mm512_set1_ps(mat[idx]);
+  auto fold = [&coef](usize row, __m512 x, __m512 y, __m512 z) {
+    __m512 res = kAffine ? _mm512_fmadd_ps(coef[6 + row], z, coef[9 + row]) : _mm512_mul_ps(coef[6 + row], z);
+    res        = _mm512_fmadd_ps(coef[3 + row], y, res);
+    return       _mm512_fmadd_ps(coef[0 + row], x, res);
+  };
+  usize idx = 0;
+  for (; idx + 16 <= count; idx += 16) {
+    __m512 x = _mm512_loadu_ps(xs + idx);
+    __m512 y = _mm512_loadu_ps(ys + idx);
+    __m512 z = _mm512_loadu_ps(zs + idx);
+    _mm512_storeu_ps(out_xs + idx, fold(0, x, y, z));
+    _mm512_storeu_ps(out_ys + idx, fold(1, x, y, z));
+    _mm512_storeu_ps(out_zs + idx, fold(2, x, y, z));
+  }
+  if (idx < count) {
+    __mmask16 mask = static_cast<__mmask16>((1U << (count - idx)) - 1);
+    __m512    x    = _mm512_maskz_loadu_ps(mask, xs + idx);
+    __m512    y    = _mm512_maskz_loadu_ps(mask, ys + idx);
+    __m512    z    = _mm512_maskz_loadu_ps(mask, zs + idx);
+    _mm512_mask_storeu_ps(out_xs + idx, mask, fold(0, x, y, z));
+    _mm512_mask_storeu_ps(out_ys + idx, mask, fold(1, x, y, z));
+    _mm512_mask_storeu_ps(out_zs + idx, mask, fold(2, x, y, z));
+  }
+}
+
+// Integer lanes with AVX512BW: 64 bytes or 32 words per register, the tail under a byte or word mask.
+inline __mmask64 ByteMask(usize count) noexcept { return count >= 64 ? ~__mmask64{0} : (__mmask64{1} << count) - 1; }
+inline __mmask32 WordMask(usize count) noexcept { return count >= 32 ? ~__mmask32{0} : static_cast<__mmask32>((1U << count) - 1); }
+
+template <typename Op> void Bytes(u8 const* lhs, u8 const* rhs, u8* out, usize count, Op op) noexcept {
+  for (usize idx = 0; idx < count; idx += 64) {
+    __mmask64 mask = ByteMask(count - idx);
+    _mm512_mask_storeu_epi8(out + idx, mask, op(_mm512_maskz_loadu_epi8(mask, lhs + idx), _mm512_maskz_loadu_epi8(mask, rhs + idx)));
+  }
+}
+template <typename Op> void Words(i16 const* lhs, i16 const* rhs, i16* out, usize count, Op op) noexcept {
+  for (usize idx = 0; idx < count; idx += 32) {
+    __mmask32 mask = WordMask(count - idx);
+    _mm512_mask_storeu_epi16(out + idx, mask, op(_mm512_maskz_loadu_epi16(mask, lhs + idx), _mm512_maskz_loadu_epi16(mask, rhs + idx)));
+  }
+}
+
+void AddSatU8  (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept { Bytes(lhs, rhs, out, count, [](__m512i reg1, __m512i reg2) { return _mm512_adds_epu8(reg1, reg2); }); }
+void SubSatU8  (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept { Bytes(lhs, rhs, out, count, [](__m512i reg1, __m512i reg2) { return _mm512_subs_epu8(reg1, reg2); }); }
+void AverageU8 (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept { Bytes(lhs, rhs, out, count, [](__m512i reg1, __m512i reg2) { return _mm512_avg_epu8(reg1, reg2); }); }
+void AddSatI16 (i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept { Words(lhs, rhs, out, count, [](__m512i reg1, __m512i reg2) { return _mm512_adds_epi16(reg1, reg2); }); }
+void SubSatI16 (i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept { Words(lhs, rhs, out, count, [](__m512i reg1, __m512i reg2) { return _mm512_subs_epi16(reg1, reg2); }); }
+void MulHighI16(i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept { Words(lhs, rhs, out, count, [](__m512i reg1, __m512i reg2) { return _mm512_mulhi_epi16(reg1, reg2); }); }
+
+// vpmovuswb saturates as unsigned, so negative words are clamped to zero first.
+void Pack(i16 const* src, u8* out, usize count) noexcept {
+  for (usize idx = 0; idx < count; idx += 32) {
+    __mmask32 mask = WordMask(count - idx);
+    _mm512_mask_cvtusepi16_storeu_epi8(out + idx, mask, _mm512_max_epi16(_mm512_maskz_loadu_epi16(mask, src + idx), _mm512_setzero_si512()));
+  }
+}
+// Back to front, tail first, so that in place no block of words overwrites bytes not read yet (see kernels/sse4.cc).
+void Unpack(u8 const* src, i16* out, usize count) noexcept {
+  for (usize idx = (count + 31) / 32 * 32; idx != 0;) {
+    idx -= 32;
+    __mmask32 mask = WordMask(count - idx);
+    _mm512_mask_storeu_epi16(out + idx, mask, _mm512_cvtepu8_epi16(_mm512_castsi512_si256(_mm512_maskz_loadu_epi8(mask, src + idx))));
+  }
+}
+
+}  // namespace
+
+Table const kAvx512Table = {
+    Transform, Normalize, Multiply, TransformSoa<false>, TransformSoa<true>,
+    AddSatU8, SubSatU8, AverageU8, AddSatI16, SubSatI16, MulHighI16, Pack, Unpack,
+};
+
+}  // namespace tf::kernels::detail
@@ -0,0 +1,149 @@
+#include "transform/kernels/kernels.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+#if defined(TRANSFORM_KERNELS_X86) && defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+#include "transform/types.h"
+#include "transform/kernels/table.h"
+#include "transform/mat/matcxr.h"
+#include "transform/vec/vec4.h"
+
+namespace tf::kernels {
+
+namespace {
+
+// The kernels treat arrays of Vec4 and Mat4 as flat column-major storage. Both are standard layout
+// with the storage first, so the casts stay valid for the empty (possibly null) batches too.
+static_assert(sizeof(Vec4<f32>) == 4 * sizeof(f32) && sizeof(Mat4<f32>) == 16 * sizeof(f32));
+static_assert(std::is_standard_layout_v<Vec4<f32>> && std::is_standard_layout_v<Mat4<f32>>);
+
+template <typename T> f32 const* Flat(T const* ptr) noexcept { return reinterpret_cast<f32 const*>(ptr); }
+template <typename T> f32      * Flat(T      * ptr) noexcept { return reinterpret_cast<f32      *>(ptr); }
+
+// The avx512 level also takes the byte and word instructions (AVX512BW) for the integer kernels.
+Level DetectLevel() noexcept {
+#if defined(TRANSFORM_KERNELS_X86) && defined(_MSC_VER)
+  int regs[4];
+  __cpuid(regs, 0);
+  int const max_leaf = regs[0];
+  __cpuid(regs, 1);
+  bool const sse4 = (regs[2] & (1 << 19)) != 0;
+  bool const fma  = (regs[2] & (1 << 12)) != 0;
+  // The OS must save the YMM (and for AVX-512 the ZMM and mask) state on context switches.
+  bool const osxsave = (regs[2] & (1 << 27)) != 0;
+  u64  const xcr0    = osxsave ? _xgetbv(0) : 0;
+  bool const ymm     = (xcr0 & 0x06) == 0x06;
+  bool const zmm     = (xcr0 & 0xE6) == 0xE6;
+  bool avx2 = false, avx512 = false;
+  if (max_leaf >= 7) {
+    __cpuidex(regs, 7, 0);
+    avx2   = (regs[1] & (1 << 5)) != 0;
+    avx512 = (regs[1] & (1 << 16)) != 0 && (regs[1] & (1 << 30)) != 0;
+  }
+  if (avx512 && fma && zmm) return Level::kAvx512;
+  if (avx2 && fma && ymm) return Level::kAvx2;
+  if (sse4) return Level::kSse4;
+#elif defined(TRANSFORM_KERNELS_X86)
+  // The builtins read cpuid once and already account for the OS-enabled register state.
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("fma")) return Level::kAvx512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return Level::kAvx2;
+  if (__builtin_cpu_supports("sse4.1")) return Level::kSse4;
+#endif
+  return Level::kScalar;
+}
+
+detail::Table const& TableFor(Level level) noexcept {
+  switch (level) {
+#ifdef TRANSFORM_KERNELS_X86
+    case Level::kAvx512: return detail::kAvx512Table;
+    case Level::kAvx2:   return detail::kAvx2Table;
+    case Level::kSse4:   return detail::kSse4Table;
+#endif
+    default:             return detail::kScalarTable;
+  }
+}
+
+Level Clamp(Level level) noexcept { return level < SupportedLevel() ? level : SupportedLevel(); }
+
+// The environment can only lower the level; unknown names are ignored.
+Level InitialLevel() noexcept {
+  char const* env = std::getenv("TRANSFORM_KERNELS_LEVEL");
+  if (env != nullptr) {
+    for (Level level : {Level::kScalar, Level::kSse4, Level::kAvx2, Level::kAvx512}) {
+      if (std::strcmp(env, LevelName(level)) == 0) return Clamp(level);
+    }
+  }
+  return SupportedLevel();
+}
+
+std::atomic<Level>& Active() noexcept {
+  static std::atomic<Level> active{InitialLevel()};
+  return active;
+}
+
+detail::Table const& ActiveTable() noexcept { return TableFor(Active().load(std::memory_order_relaxed)); }
+
+}  // namespace
+
+// --- Dispatch ---
+Level SupportedLevel() noexcept {
+  static Level const supported = DetectLevel();
+  return supported;
+}
+
+Level ActiveLevel()           noexcept { return Active().load(std::memory_order_relaxed); }
+void  ForceLevel(Level level) noexcept { Active().store(Clamp(level), std::memory_order_relaxed); }
+
+char const* LevelName(Level level) noexcept {
+  switch (level) {
+    case Level::kScalar: return "scalar";
+    case Level::kSse4:   return "sse4";
+    case Level::kAvx2:   return "avx2";
+    case Level::kAvx512: return "avx512";
+  }
+  return "unknown";
+}
+
+// --- Kernels ---
+void Transform(Mat4<f32> const& mat, Vec4<f32> const* vecs, Vec4<f32>* out, usize count) noexcept {
+  ActiveTable().transform(mat.data(), Flat(vecs), Flat(out), count);
+}
+
+void Normalize(Vec4<f32> const* vecs, Vec4<f32>* out, usize count) noexcept {
+  ActiveTable().normalize(Flat(vecs), Flat(out), count);
+}
+
+void Multiply(Mat4<f32> const* lhs, Mat4<f32> const* rhs, Mat4<f32>* out, usize count) noexcept {
+  ActiveTable().multiply(Flat(lhs), Flat(rhs), Flat(out), count);
+}
+
+// --- Structure-of-arrays kernels ---
+void TransformSoa(Mat3<f32> const& mat, f32 const* xs, f32 const* ys, f32 const* zs, f32* out_xs, f32* out_ys, f32* out_zs, usize count) noexcept {
+  ActiveTable().transform_soa3(mat.data(), xs, ys, zs, out_xs, out_ys, out_zs, count);
+}
+
+void TransformSoa(Mat4<f32> const& mat, f32 const* xs, f32 const* ys, f32 const* zs, f32* out_xs, f32* out_ys, f32* out_zs, usize count) noexcept {
+  f32 affine[12];
+  for (usize idx = 0; idx < 12; ++idx) affine[idx] = mat[idx / 3][idx % 3];
+  ActiveTable().transform_soa4(affine, xs, ys, zs, out_xs, out_ys, out_zs, count);
+}
+
+// --- Saturating integer kernels ---
+void AddSat (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept { ActiveTable().add_sat_u8  (lhs, rhs, out, count); }
+void SubSat (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept { ActiveTable().sub_sat_u8  (lhs, rhs, out, count); }
+void Average(u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept { ActiveTable().average_u8  (lhs, rhs, out, count); }
+void AddSat (i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept { ActiveTable().add_sat_i16 (lhs, rhs, out, count); }
+void SubSat (i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept { ActiveTable().sub_sat_i16 (lhs, rhs, out, count); }
+void MulHigh(i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept { ActiveTable().mul_high_i16(lhs, rhs, out, count); }
+void Pack   (i16 const* src, u8*  out, usize count) noexcept { ActiveTable().pack_u8  (src, out, count); }
+void Unpack (u8  const* src, i16* out, usize count) noexcept { ActiveTable().unpack_u8(src, out, count); }
+
+}  // namespace tf::kernels
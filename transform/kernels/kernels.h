@@ -0,0 +1,84 @@
+#ifndef TRANSFORM_KERNELS_KERNELS_H_
+#define TRANSFORM_KERNELS_KERNELS_H_
+
+#include "transform/types.h"
+#include "transform/mat/matcxr.h"
+#include "transform/vec/vec4.h"
+#include "transform/vec/vecn.h"
+
+// Batch kernels of the compiled `transform::kernels` target. Unlike the header-only SIMD backend, every
+// instruction set is built into the library and the widest one the CPU supports is picked at first use,
+// so a single binary runs everywhere. Set TRANSFORM_KERNELS_LEVEL (scalar, sse4, avx2 or avx512) in the
+// environment, or call ForceLevel, to pin a lower level for testing.
+
+namespace tf::kernels {
+
+enum class Level : u8 {
+  kScalar,
+  kSse4,
+  kAvx2,
+  kAvx512,
+};
+
+// --- Dispatch ---
+Level       SupportedLevel()        noexcept;  // Widest level both the CPU and the OS support
+Level       ActiveLevel()           noexcept;  // Level the kernels below run at
+void        ForceLevel(Level level) noexcept;  // Clamped to SupportedLevel
+char const* LevelName (Level level) noexcept;
+
+// --- Kernels ---
+// Each output may alias its input; otherwise the ranges must not overlap.
+void Transform(Mat4<f32> const& mat, Vec4<f32> const* vecs, Vec4<f32>* out, usize count) noexcept;  // out[i] = mat * vecs[i]
+void Normalize(Vec4<f32> const* vecs, Vec4<f32>* out, usize count) noexcept;                        // out[i] = Normalize(vecs[i])
+void Multiply (Mat4<f32> const* lhs, Mat4<f32> const* rhs, Mat4<f32>* out, usize count) noexcept;   // out[i] = lhs[i] * rhs[i]
+
+// --- Structure-of-arrays kernels ---
+// Points split into x, y and z arrays: a Mat3 applies as mat * (x, y, z), a Mat4 as the first three
+// components of mat * (x, y, z, 1), so its last row is ignored. Each output may alias its own input.
+void TransformSoa(Mat3<f32> const& mat, f32 const* xs, f32 const* ys, f32 const* zs, f32* out_xs, f32* out_ys, f32* out_zs, usize count) noexcept;
+void TransformSoa(Mat4<f32> const& mat, f32 const* xs, f32 const* ys, f32 const* zs, f32* out_xs, f32* out_ys, f32* out_zs, usize count) noexcept;
+
+// --- Saturating integer kernels ---
+// Pixel and sample data as flat lanes, each matching the function of the same name in `transform/vec/func.h`.
+// `Pack` narrows to u8 like SaturateCast<u8>, `Unpack` zero-extends. Each output may alias its own input, including
+// the u8 and i16 buffers of `Pack` and `Unpack` starting at the same address (`Unpack` runs back to front for that).
+void AddSat (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept;
+void SubSat (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept;
+void Average(u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept;
+void AddSat (i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept;
+void SubSat (i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept;
+void MulHigh(i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept;
+void Pack   (i16 const* src, u8*  out, usize count) noexcept;
+void Unpack (u8  const* src, i16* out, usize count) noexcept;
+
+// The same over `count` vectors, e.g. spans of Vec4<u8> pixels.
+template <usize L, typename T> void AddSat (Vec<L, T> const* lhs, Vec<L, T> const* rhs, Vec<L, T>* out, usize count) noexcept;
+template <usize L, typename T> void SubSat (Vec<L, T> const* lhs, Vec<L, T> const* rhs, Vec<L, T>* out, usize count) noexcept;
+template <usize L>             void Average(Vec<L, u8>  const* lhs, Vec<L, u8>  const* rhs, Vec<L, u8>*  out, usize count) noexcept;
+template <usize L>             void MulHigh(Vec<L, i16> const* lhs, Vec<L, i16> const* rhs, Vec<L, i16>* out, usize count) noexcept;
+template <usize L>             void Pack   (Vec<L, i16> const* src, Vec<L, u8>*  out, usize count) noexcept;
+template <usize L>             void Unpack (Vec<L, u8>  const* src, Vec<L, i16>* out, usize count) noexcept;
+
+/************************
+ * Function definitions *
+ ************************/
+
+namespace detail {
+
+// Arrays of Vec<L, T> are L * count packed lanes.
+template <usize L, typename T> T const* Lanes(Vec<L, T> const* ptr) noexcept { static_assert(sizeof(Vec<L, T>) == L * sizeof(T)); return reinterpret_cast<T const*>(ptr); }
+template <usize L, typename T> T      * Lanes(Vec<L, T>      * ptr) noexcept { static_assert(sizeof(Vec<L, T>) == L * sizeof(T)); return reinterpret_cast<T      *>(ptr); }
+
+}  // namespace detail
+
+// --- Saturating integer kernels ---
+template <usize L, typename T> void AddSat (Vec<L, T> const* lhs, Vec<L, T> const* rhs, Vec<L, T>* out, usize count) noexcept { AddSat (detail::Lanes(lhs), detail::Lanes(rhs), detail::Lanes(out), L * count); }
+template <usize L, typename T> void SubSat (Vec<L, T> const* lhs, Vec<L, T> const* rhs, Vec<L, T>* out, usize count) noexcept { SubSat (detail::Lanes(lhs), detail::Lanes(rhs), detail::Lanes(out), L * count); }
+template <usize L>             void Average(Vec<L, u8>  const* lhs, Vec<L, u8>  const* rhs, Vec<L, u8>*  out, usize count) noexcept { Average(detail::Lanes(lhs), detail::Lanes(rhs), detail::Lanes(out), L * count); }
+template <usize L>             void MulHigh(Vec<L, i16> const* lhs, Vec<L, i16> const* rhs, Vec<L, i16>* out, usize count) noexcept { MulHigh(detail::Lanes(lhs), detail::Lanes(rhs), detail::Lanes(out), L * count); }
+template <usize L>             void Pack   (Vec<L, i16> const* src, Vec<L, u8>*  out, usize count) noexcept { Pack  (detail::Lanes(src), detail::Lanes(out), L * count); }
+template <usize L>             void Unpack (Vec<L, u8>  const* src, Vec<L, i16>* out, usize count) noexcept { Unpack(detail::Lanes(src), detail::Lanes(out), L * count); }
+
+}  // namespace tf::kernels
+
+#endif  // TRANSFORM_KERNELS_KERNELS_H_
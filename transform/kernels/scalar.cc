@@ -0,0 +1,75 @@
+#include "transform/kernels/table.h"
+
+#include "transform/types.h"
+#include "transform/mat/matcxr.h"
+#include "transform/vec/func.h"
+#include "transform/vec/vec3.h"
+#include "transform/vec/vec4.h"
+
+namespace tf::kernels::detail {
+
+namespace {
+
+// The reference level reuses the header operators, so it matches `mat * vec` exactly.
+Mat4<f32> LoadMat(f32 const* src) noexcept {
+  Mat4<f32> mat;
+  for (usize idx = 0; idx < 4; ++idx) mat[idx] = Vec4<f32>(src[4 * idx + 0], src[4 * idx + 1], src[4 * idx + 2], src[4 * idx + 3]);
+  return mat;
+}
+Vec4<f32> LoadVec(f32 const* src) noexcept { return Vec4<f32>(src[0], src[1], src[2], src[3]); }
+
+void StoreMat(Mat4<f32> const& mat, f32* dst) noexcept {
+  for (usize idx = 0; idx < 16; ++idx) dst[idx] = mat[idx / 4][idx % 4];
+}
+void StoreVec(Vec4<f32> const& vec, f32* dst) noexcept {
+  for (usize idx = 0; idx < 4; ++idx) dst[idx] = vec[idx];
+}
+
+void Transform(f32 const* mat, f32 const* vecs, f32* out, usize count) noexcept {
+  Mat4<f32> const lhs = LoadMat(mat);
+  for (usize idx = 0; idx < count; ++idx) StoreVec(lhs * LoadVec(vecs + 4 * idx), out + 4 * idx);
+}
+
+void Normalize(f32 const* vecs, f32* out, usize count) noexcept {
+  for (usize idx = 0; idx < count; ++idx) StoreVec(tf::Normalize(LoadVec(vecs + 4 * idx)), out + 4 * idx);
+}
+
+void Multiply(f32 const* lhs, f32 const* rhs, f32* out, usize count) noexcept {
+  for (usize idx = 0; idx < count; ++idx) StoreMat(LoadMat(lhs + 16 * idx) * LoadMat(rhs + 16 * idx), out + 16 * idx);
+}
+
+// Mat<N, 3> * Vec<N>, with the homogeneous 1 appended for the affine block.
+template <usize N> void TransformSoa(f32 const* mat, f32 const* xs, f32 const* ys, f32 const* zs, f32* out_xs, f32* out_ys, f32* out_zs, usize count) noexcept {
+  Mat<N, 3, f32> lhs;
+  for (usize col = 0; col < N; ++col) lhs[col] = Vec3<f32>(mat[3 * col + 0], mat[3 * col + 1], mat[3 * col + 2]);
+  for (usize idx = 0; idx < count; ++idx) {
+    Vec<N, f32> vec(xs[idx], ys[idx], zs[idx]);
+    if constexpr (N == 4) vec[3] = 1.0F;
+    Vec3<f32> const res = lhs * vec;
+    out_xs[idx]         = res[0];
+    out_ys[idx]         = res[1];
+    out_zs[idx]         = res[2];
+  }
+}
+
+// Integer lanes through the scalar overloads of `transform/vec/func.h`.
+template <typename T, T (*kOp)(T, T)> void Lanes(T const* lhs, T const* rhs, T* out, usize count) noexcept {
+  for (usize idx = 0; idx < count; ++idx) out[idx] = kOp(lhs[idx], rhs[idx]);
+}
+
+void Pack(i16 const* src, u8* out, usize count) noexcept {
+  for (usize idx = 0; idx < count; ++idx) out[idx] = SaturateCast<u8>(src[idx]);
+}
+// Back to front: in place, each word would otherwise overwrite the next byte before it is read.
+void Unpack(u8 const* src, i16* out, usize count) noexcept {
+  for (usize idx = count; idx-- > 0;) out[idx] = src[idx];
+}
+
+}  // namespace
+
+Table const kScalarTable = {
+    Transform, Normalize, Multiply, TransformSoa<3>, TransformSoa<4>,
+    Lanes<u8, AddSat<u8>>, Lanes<u8, SubSat<u8>>, Lanes<u8, Average<u8>>, Lanes<i16, AddSat<i16>>, Lanes<i16, SubSat<i16>>, Lanes<i16, MulHigh<i16>>, Pack, Unpack,
+};
+
+}  // namespace tf::kernels::detail
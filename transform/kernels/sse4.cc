@@ -0,0 +1,146 @@
+#include "transform/kernels/table.h"
+
+#include <cstring>
+
+#include <immintrin.h>
+
+#include "transform/types.h"
+
+namespace tf::kernels::detail {
+
+namespace {
+
+// Right fold over the columns, the same order as the scalar Mat * Vec.
+inline __m128 MulColumns(__m128 col0, __m128 col1, __m128 col2, __m128 col3, __m128 vec) noexcept {
+  __m128 res = _mm_mul_ps(col3, _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(3, 3, 3, 3)));
+  res        = _mm_add_ps(_mm_mul_ps(col2, _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(2, 2, 2, 2))), res);
+  res        = _mm_add_ps(_mm_mul_ps(col1, _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(1, 1, 1, 1))), res);
+  return       _mm_add_ps(_mm_mul_ps(col0, _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(0, 0, 0, 0))), res);
+}
+
+void Transform(f32 const* mat, f32 const* vecs, f32* out, usize count) noexcept {
+  __m128 col0 = _mm_loadu_ps(mat + 0);
+  __m128 col1 = _mm_loadu_ps(mat + 4);
+  __m128 col2 = _mm_loadu_ps(mat + 8);
+  __m128 col3 = _mm_loadu_ps(mat + 12);
+  for (usize idx = 0; idx < 4 * count; idx += 4) _mm_storeu_ps(out + idx, MulColumns(col0, col1, col2, col3, _mm_loadu_ps(vecs + idx)));
+}
+
+// SSE4.1 dot product broadcasts the squared length to every lane.
+void Normalize(f32 const* vecs, f32* out, usize count) noexcept {
+  for (usize idx = 0; idx < 4 * count; idx += 4) {
+    __m128 vec = _mm_loadu_ps(vecs + idx);
+    _mm_storeu_ps(out + idx, _mm_div_ps(vec, _mm_sqrt_ps(_mm_dp_ps(vec, vec, 0xFF))));
+  }
+}
+
+void Multiply(f32 const* lhs, f32 const* rhs, f32* out, usize count) noexcept {
+  for (usize mat = 0; mat < 16 * count; mat += 16) {
+    __m128 col0 = _mm_loadu_ps(lhs + mat + 0);
+    __m128 col1 = _mm_loadu_ps(lhs + mat + 4);
+    __m128 col2 = _mm_loadu_ps(lhs + mat + 8);
+    __m128 col3 = _mm_loadu_ps(lhs + mat + 12);
+    __m128 res0 = MulColumns(col0, col1, col2, col3, _mm_loadu_ps(rhs + mat + 0));
+    __m128 res1 = MulColumns(col0, col1, col2, col3, _mm_loadu_ps(rhs + mat + 4));
+    __m128 res2 = MulColumns(col0, col1, col2, col3, _mm_loadu_ps(rhs + mat + 8));
+    __m128 res3 = MulColumns(col0, col1, col2, col3, _mm_loadu_ps(rhs + mat + 12));
+    _mm_storeu_ps(out + mat + 0, res0);
+    _mm_storeu_ps(out + mat + 4, res1);
+    _mm_storeu_ps(out + mat + 8, res2);
+    _mm_storeu_ps(out + mat + 12, res3);
+  }
+}
+
+// Structure-of-arrays points, four per register. Each row is the right fold m0 * x + (m1 * y + (m2 * z + m3)),
+// the scalar Mat * Vec order; the tail runs the same fold on single lanes.
+template <bool kAffine> void TransformSoa(f32 const* mat, f32 const* xs, f32 const* ys, f32 const* zs, f32* out_xs, f32* out_ys, f32* out_zs, usize count) noexcept {
+  __m128 coef[12];
+  for (usize idx = 0; idx < (kAffine ? 12 : 9); ++idx) coef[idx] = _mm_set1_ps(mat[idx]);
+  auto fold = [&coef](usize row, __m128 x, __m128 y, __m128 z) {
+    __m128 res = _mm_mul_ps(coef[6 + row], z);
+    if constexpr (kAffine) res = _mm_add_ps(res, coef[9 + row]);
+    res        = _mm_add_ps(_mm_mul_ps(coef[3 + row], y), res);
+    return       _mm_add_ps(_mm_mul_ps(coef[0 + row], x), res);
+  };
+  usize idx = 0;
+  for (; idx + 4 <= count; idx += 4) {
+    __m128 x = _mm_loadu_ps(xs + idx);
+    __m128 y = _mm_loadu_ps(ys + idx);
+    __m128 z = _mm_loadu_ps(zs + idx);
+    _mm_storeu_ps(out_xs + idx, fold(0, x, y, z));
+    _mm_storeu_ps(out_ys + idx, fold(1, x, y, z));
+    _mm_storeu_ps(out_zs + idx, fold(2, x, y, z));
+  }
+  for (; idx < count; ++idx) {
+    __m128 x = _mm_load_ss(xs + idx);
+    __m128 y = _mm_load_ss(ys + idx);
+    __m128 z = _mm_load_ss(zs + idx);
+    _mm_store_ss(out_xs + idx, fold(0, x, y, z));
+    _mm_store_ss(out_ys + idx, fold(1, x, y, z));
+    _mm_store_ss(out_zs + idx, fold(2, x, y, z));
+  }
+}
+
+// Integer lanes, one register per block. The partial block at the end runs through zero-filled stack
+// copies, so the tail reuses the vector operation instead of a scalar copy of it.
+template <typename In, typename Out, usize kLanes, typename Op> void Blocks(In const* lhs, In const* rhs, Out* out, usize count, Op op) noexcept {
+  usize idx = 0;
+  for (; idx + kLanes <= count; idx += kLanes) op(lhs + idx, rhs + idx, out + idx);
+  if (idx == count) return;
+  In  lhs_tail[kLanes] = {};
+  In  rhs_tail[kLanes] = {};
+  Out out_tail[kLanes];
+  std::memcpy(lhs_tail, lhs + idx, (count - idx) * sizeof(In));
+  std::memcpy(rhs_tail, rhs + idx, (count - idx) * sizeof(In));
+  op(lhs_tail, rhs_tail, out_tail);
+  std::memcpy(out + idx, out_tail, (count - idx) * sizeof(Out));
+}
+
+template <typename T> inline __m128i Load (T const* src)          noexcept { return _mm_loadu_si128(reinterpret_cast<__m128i const*>(src)); }
+template <typename T> inline void    Store(T* dst, __m128i lanes) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), lanes); }
+
+template <typename T, typename Op> void Lanes(T const* lhs, T const* rhs, T* out, usize count, Op op) noexcept {
+  Blocks<T, T, 16 / sizeof(T)>(lhs, rhs, out, count, [op](T const* src1, T const* src2, T* dst) { Store(dst, op(Load(src1), Load(src2))); });
+}
+
+void AddSatU8  (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept { Lanes(lhs, rhs, out, count, [](__m128i reg1, __m128i reg2) { return _mm_adds_epu8(reg1, reg2); }); }
+void SubSatU8  (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept { Lanes(lhs, rhs, out, count, [](__m128i reg1, __m128i reg2) { return _mm_subs_epu8(reg1, reg2); }); }
+void AverageU8 (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept { Lanes(lhs, rhs, out, count, [](__m128i reg1, __m128i reg2) { return _mm_avg_epu8(reg1, reg2); }); }
+void AddSatI16 (i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept { Lanes(lhs, rhs, out, count, [](__m128i reg1, __m128i reg2) { return _mm_adds_epi16(reg1, reg2); }); }
+void SubSatI16 (i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept { Lanes(lhs, rhs, out, count, [](__m128i reg1, __m128i reg2) { return _mm_subs_epi16(reg1, reg2); }); }
+void MulHighI16(i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept { Lanes(lhs, rhs, out, count, [](__m128i reg1, __m128i reg2) { return _mm_mulhi_epi16(reg1, reg2); }); }
+
+// Sixteen lanes per block either way: two registers of words narrow into one of bytes and back.
+void Pack(i16 const* src, u8* out, usize count) noexcept {
+  Blocks<i16, u8, 16>(src, src, out, count, [](i16 const* words, i16 const*, u8* bytes) { Store(bytes, _mm_packus_epi16(Load(words), Load(words + 8))); });
+}
+// Back to front, tail first: in place, a block of words covers the bytes of the next block, so every block must be
+// read before any block below it is written.
+void Unpack(u8 const* src, i16* out, usize count) noexcept {
+  auto const unpack = [](u8 const* bytes, i16* words) {
+    __m128i lanes = Load(bytes);
+    Store(words + 0, _mm_cvtepu8_epi16(lanes));
+    Store(words + 8, _mm_cvtepu8_epi16(_mm_srli_si128(lanes, 8)));
+  };
+  usize idx = count - count % 16;
+  if (idx != count) {
+    u8  bytes_tail[16] = {};
+    i16 words_tail[16];
+    std::memcpy(bytes_tail, src + idx, count - idx);
+    unpack(bytes_tail, words_tail);
+    std::memcpy(out + idx, words_tail, (count - idx) * sizeof(i16));
+  }
+  while (idx != 0) {
+    idx -= 16;
+    unpack(src + idx, out + idx);
+  }
+}
+
+}  // namespace
+
+Table const kSse4Table = {
+    Transform, Normalize, Multiply, TransformSoa<false>, TransformSoa<true>,
+    AddSatU8, SubSatU8, AverageU8, AddSatI16, SubSatI16, MulHighI16, Pack, Unpack,
+};
+
+}  // namespace tf::kernels::detail
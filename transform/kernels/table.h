@@ -0,0 +1,42 @@
+#ifndef TRANSFORM_KERNELS_TABLE_H_
+#define TRANSFORM_KERNELS_TABLE_H_
+
+#include "transform/types.h"
+
+// Internal to the kernels target. The per-level sources are compiled with their own instruction-set
+// flags, so they only see raw column-major storage: pulling a shared inline function (a Vec operator,
+// std::sqrt) into them could hand the linker a copy that faults on an older CPU.
+
+namespace tf::kernels::detail {
+
+struct Table {
+  void (*transform)(f32 const* mat, f32 const* vecs, f32* out, usize count) noexcept;
+  void (*normalize)(f32 const* vecs, f32* out, usize count) noexcept;
+  void (*multiply) (f32 const* lhs, f32 const* rhs, f32* out, usize count) noexcept;
+
+  // Structure-of-arrays points. `mat` holds the upper three rows column by column: nine
+  // coefficients for a Mat3, twelve (the last three being the translation) for a Mat4.
+  void (*transform_soa3)(f32 const* mat, f32 const* xs, f32 const* ys, f32 const* zs, f32* out_xs, f32* out_ys, f32* out_zs, usize count) noexcept;
+  void (*transform_soa4)(f32 const* mat, f32 const* xs, f32 const* ys, f32 const* zs, f32* out_xs, f32* out_ys, f32* out_zs, usize count) noexcept;
+
+  // Saturating integer lanes; `count` counts lanes, not vectors.
+  void (*add_sat_u8)  (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept;
+  void (*sub_sat_u8)  (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept;
+  void (*average_u8)  (u8  const* lhs, u8  const* rhs, u8*  out, usize count) noexcept;
+  void (*add_sat_i16) (i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept;
+  void (*sub_sat_i16) (i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept;
+  void (*mul_high_i16)(i16 const* lhs, i16 const* rhs, i16* out, usize count) noexcept;
+  void (*pack_u8)     (i16 const* src, u8*  out, usize count) noexcept;
+  void (*unpack_u8)   (u8  const* src, i16* out, usize count) noexcept;
+};
+
+extern Table const kScalarTable;
+#ifdef TRANSFORM_KERNELS_X86
+extern Table const kSse4Table;
+extern Table const kAvx2Table;
+extern Table const kAvx512Table;
+#endif
+
+}  // namespace tf::kernels::detail
+
+#endif  // TRANSFORM_KERNELS_TABLE_H_
@@ -1,6 +1,7 @@
 #ifndef TRANSFORM_MAT_H_
 #define TRANSFORM_MAT_H_
 
+#include "transform/mat/aligned.h"
 #include "transform/mat/func.h"
 #include "transform/mat/mat.h"
 #include "transform/mat/mat1x1.h"
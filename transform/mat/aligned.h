@@ -0,0 +1,72 @@
+#ifndef TRANSFORM_MAT_ALIGNED_H_
+#define TRANSFORM_MAT_ALIGNED_H_
+
+#include <algorithm>
+#include <bit>
+#include <type_traits>
+
+#include "transform/types.h"
+#include "transform/mat/matcxr.h"
+
+namespace tf {
+
+// Smallest power of two that holds the whole matrix, capped at a cache line.
+template <usize C, usize R, typename T> inline constexpr usize kMatAlignment = std::min<usize>(std::bit_ceil(C * R * sizeof(T)), 64);
+
+// Over-aligned Mat. It adds no members, so it binds to Mat<C, R, T> const& and
+// converts back from a packed Mat at no cost. Every Mat operator accepts it.
+template <usize C, usize R, typename T, usize A = kMatAlignment<C, R, T>> class alignas(A) AlignedMat : public Mat<C, R, T> {
+  static_assert(std::has_single_bit(A) && A >= alignof(Mat<C, R, T>));
+
+ public:
+  // --- Types ---
+  using PackedType = Mat<C, R, T>;
+
+  // --- Implicit basic constructors ---
+  constexpr AlignedMat() noexcept;
+  constexpr AlignedMat(AlignedMat const& mat)     = default;
+  constexpr AlignedMat(AlignedMat&& mat) noexcept = default;
+
+  constexpr AlignedMat(Mat<C, R, T> const& mat) noexcept;  // NOLINT(*-explicit-constructor)
+
+  // --- Conversion constructors ---
+  using Mat<C, R, T>::Mat;
+
+  // --- Destructor ---
+  inline ~AlignedMat() noexcept = default;
+
+  // --- Packed access ---
+  constexpr Mat<C, R, T> &      packed()       noexcept;  // NOLINT(*-identifier-naming)
+  constexpr Mat<C, R, T> const& packed() const noexcept;  // NOLINT(*-identifier-naming)
+
+  // --- Unary operators ---
+  constexpr AlignedMat& operator=(AlignedMat const& mat)     = default;
+  constexpr AlignedMat& operator=(AlignedMat&& mat) noexcept = default;
+};
+
+// --- Alias ---
+template <typename T> using AlignedMat2 = AlignedMat<2, 2, T>;
+template <typename T> using AlignedMat3 = AlignedMat<3, 3, T>;
+template <typename T> using AlignedMat4 = AlignedMat<4, 4, T>;
+
+// --- Layout ---
+static_assert(alignof(AlignedMat4<f32>) == 64 && sizeof(AlignedMat4<f32>) == sizeof(Mat4<f32>));
+static_assert(alignof(AlignedMat4<f64>) == 64 && sizeof(AlignedMat4<f64>) == sizeof(Mat4<f64>));
+static_assert(std::is_trivially_copyable_v<AlignedMat4<f32>> && std::is_standard_layout_v<AlignedMat4<f32>>);
+
+/************************
+ * Function definitions *
+ ************************/
+
+// --- Implicit basic constructors ---
+template <usize C, usize R, typename T, usize A> constexpr AlignedMat<C, R, T, A>::AlignedMat() noexcept : Mat<C, R, T>() {}
+
+template <usize C, usize R, typename T, usize A> constexpr AlignedMat<C, R, T, A>::AlignedMat(Mat<C, R, T> const& mat) noexcept : Mat<C, R, T>(mat) {}
+
+// --- Packed access ---
+template <usize C, usize R, typename T, usize A> constexpr Mat<C, R, T> &      AlignedMat<C, R, T, A>::packed()       noexcept { return *this; }  // NOLINT(*-identifier-naming)
+template <usize C, usize R, typename T, usize A> constexpr Mat<C, R, T> const& AlignedMat<C, R, T, A>::packed() const noexcept { return *this; }  // NOLINT(*-identifier-naming)
+
+}  // namespace tf
+
+#endif  // TRANSFORM_MAT_ALIGNED_H_
@@ -2,7 +2,8 @@
 #define TRANSFORM_MAT_FUNC_H_
 
 #include <cassert>
-#include <cmath>
+#include <type_traits>
+#include <utility>
 
 #include "transform/types.h"
 #include "transform/mat/mat.h"
@@ -11,12 +12,9 @@
 namespace tf {
 
 template <usize C, usize R, typename T> constexpr Mat<C - 1, R, T> CutCol(Mat<C, R, T> const& mat, usize col);
-template          <usize R, typename T> constexpr Mat<1    , R, T> CutCol(Mat<2, R, T> const& mat, usize col);
 
 template <usize C, usize R, typename T> constexpr Mat<C, R - 1, T> CutRow(Mat<C, R, T> const& mat, usize row);
-template          <usize R, typename T> constexpr Mat<1, R - 1, T> CutRow(Mat<1, R, T> const& mat, usize row);
 template          <usize R, typename T> constexpr Vec<   R - 1, T> CutRow(Vec<   R, T> const& vec, usize row);
-template                   <typename T> constexpr Vec<   1    , T> CutRow(Vec<   2, T> const& vec, usize row);
 
 template <usize C, usize R, typename T> constexpr Mat<C - 1, R - 1, T> CutDown(Mat<C, R, T> const& mat, usize col, usize row);
 
@@ -24,43 +22,178 @@ template <usize R, typename T> constexpr T Minor(Mat<R, R, T> const& mat, usize
 
 template <usize R, typename T> constexpr T Cofactor(Mat<R, R, T> const& mat, usize col, usize row);
 
+// Closed forms up to 4x4. Larger sizes use Bareiss elimination for integral T
+// (fraction-free, in a type twice as wide as T) and LU with partial pivoting
+// otherwise, both O(n^3).
 template <usize R, typename T> constexpr T Determinant(Mat<R, R, T> const& mat);
 template          <typename T> constexpr T Determinant(Mat<1, 1, T> const& mat);
+template          <typename T> constexpr T Determinant(Mat<2, 2, T> const& mat);
+template          <typename T> constexpr T Determinant(Mat<3, 3, T> const& mat);
+template          <typename T> constexpr T Determinant(Mat<4, 4, T> const& mat);
 
 template <usize R, typename T> constexpr Mat<R, R, T> CofactorMatrix(Mat<R, R, T> const& mat);
 
 template <usize C, usize R, typename T> constexpr Mat<C, R, T> Transpose(Mat<R, C, T> const& mat);
-template          <usize R, typename T> constexpr Mat<1, R, T> Transpose(Mat<R, 1, T> const& mat);
 
+// Mat2, Mat3 and Mat4 use the adjugate in closed form. Mat4 shares twelve 2x2
+// sub-determinants between the determinant and every cofactor.
 template <usize R, typename T> constexpr Mat<R, R, T> Inverse(Mat<R, R, T> const& mat);
+template          <typename T> constexpr Mat<2, 2, T> Inverse(Mat<2, 2, T> const& mat);
+template          <typename T> constexpr Mat<3, 3, T> Inverse(Mat<3, 3, T> const& mat);
+template          <typename T> constexpr Mat<4, 4, T> Inverse(Mat<4, 4, T> const& mat);
 
 /************************
  * Function definitions *
  ************************/
 
-template <usize C, usize R, typename T> constexpr Mat<C - 1, R, T> CutCol(Mat<C, R, T> const& mat, usize col) { assert(col < C); return col == 0 ? mat.tail() : Mat<C - 1, R, T>(mat.head(), CutCol(mat.tail(), col - 1)); }
-template          <usize R, typename T> constexpr Mat<1    , R, T> CutCol(Mat<2, R, T> const& mat, usize col) { assert(col < 2); return col == 0 ? mat.tail() : Mat<1    , R, T>(mat.head()                             ); }
+template <usize C, usize R, typename T> constexpr Mat<C - 1, R, T> CutCol(Mat<C, R, T> const& mat, usize col) { assert(col < C); Mat<C - 1, R, T> result; for (usize idx = 0; idx < C - 1; ++idx) result[idx] = mat[idx < col ? idx : idx + 1]; return result; }
 
-template <usize C, usize R, typename T> constexpr Mat<C, R - 1, T> CutRow(Mat<C, R, T> const& mat, usize row) { assert(row < R); return Mat<C, R - 1, T>(CutRow(mat.head(), row), CutRow(mat.tail(), row)); }
-template          <usize R, typename T> constexpr Mat<1, R - 1, T> CutRow(Mat<1, R, T> const& mat, usize row) { assert(row < R); return Mat<1, R - 1, T>(CutRow(mat.head(), row)                         ); }
-template          <usize R, typename T> constexpr Vec<   R - 1, T> CutRow(Vec<   R, T> const& vec, usize row) { assert(row < R); return row == 0 ? vec.tail() : Vec<R - 1, T>(vec.head(), CutRow(vec.tail(), row - 1)); }
-template                   <typename T> constexpr Vec<   1    , T> CutRow(Vec<   2, T> const& vec, usize row) { assert(row < 2); return row == 0 ? vec.tail() : Vec<1    , T>(vec.head()                             ); }
+template <usize C, usize R, typename T> constexpr Mat<C, R - 1, T> CutRow(Mat<C, R, T> const& mat, usize row) { assert(row < R); Mat<C, R - 1, T> result; for (usize idx = 0; idx < C; ++idx) result[idx] = CutRow(mat[idx], row); return result; }
+template          <usize R, typename T> constexpr Vec<   R - 1, T> CutRow(Vec<   R, T> const& vec, usize row) { assert(row < R); Vec<R - 1, T> result; for (usize idx = 0; idx < R - 1; ++idx) result[idx] = vec[idx < row ? idx : idx + 1]; return result; }
 
 template <usize C, usize R, typename T> constexpr Mat<C - 1, R - 1, T> CutDown(Mat<C, R, T> const& mat, usize col, usize row) { assert(col < C && row < R); return CutRow(CutCol(mat, col), row); }
 
 template <usize R, typename T> constexpr T Minor(Mat<R, R, T> const& mat, usize col, usize row) { return Determinant(CutDown(mat, col, row)); }
 
-template <usize R, typename T> constexpr T Cofactor(Mat<R, R, T> const& mat, usize col, usize row) { return static_cast<T>(std::pow(-1, col + row)) * Minor(mat, col, row); }
-
-template <usize R, typename T> constexpr T Determinant(Mat<R, R, T> const& mat) { T result{}; for (usize col = 0; col < R; ++col) result = mat[col][0] * Cofactor(mat, col, 0) + result; return result; }
-template          <typename T> constexpr T Determinant(Mat<1, 1, T> const& mat) { return mat[0][0]; }
+template <usize R, typename T> constexpr T Cofactor(Mat<R, R, T> const& mat, usize col, usize row) { T minor = Minor(mat, col, row); return (col + row) % 2 == 0 ? minor : static_cast<T>(-minor); }
+
+namespace detail {
+// Bareiss multiplies two k x k minors before it divides by the previous pivot, which overflows T long before the
+// determinant does, so the elimination runs in a type twice as wide. void where there is none (64-bit T without
+// __int128), and Determinant keeps the cofactor expansion there.
+#ifdef __SIZEOF_INT128__
+__extension__ using i128 = __int128;
+template <typename T> using BareissInt = std::conditional_t<sizeof(T) <= 4, i64, i128>;
+#else
+template <typename T> using BareissInt = std::conditional_t<sizeof(T) <= 4, i64, void>;
+#endif
+}  // namespace detail
+
+template <usize R, typename T> constexpr T Determinant(Mat<R, R, T> const& mat) {
+  // The determinant is invariant under transposition, so columns act as rows
+  // here and a pivot swap exchanges whole columns.
+  if constexpr (std::is_integral_v<T> && std::is_void_v<detail::BareissInt<T>>) {
+    T result{};
+    for (usize col = 0; col < R; ++col) result = static_cast<T>(result + mat[col][0] * Cofactor(mat, col, 0));
+    return result;
+  } else if constexpr (std::is_integral_v<T>) {
+    // Unsigned T is read as its signed counterpart first. The entries stay congruent modulo 2^n, so the determinant
+    // does too, and the one cast back at the end wraps it like T arithmetic would.
+    using Wide = detail::BareissInt<T>;
+    Mat<R, R, Wide> lu = Mat<R, R, Wide>(Mat<R, R, std::make_signed_t<T>>(mat));
+    Wide result = 1;
+    Wide prev   = 1;
+    for (usize piv = 0; piv < R; ++piv) {
+      if (lu[piv][piv] == 0) {
+        usize swp = piv + 1;
+        while (swp < R && lu[swp][piv] == 0) ++swp;
+        if (swp == R) return T{};
+        std::swap(lu[piv], lu[swp]);
+        result = -result;
+      }
+      for (usize col = piv + 1; col < R; ++col)
+        for (usize row = piv + 1; row < R; ++row) lu[col][row] = (lu[col][row] * lu[piv][piv] - lu[col][piv] * lu[piv][row]) / prev;
+      prev = lu[piv][piv];
+    }
+    return static_cast<T>(result * lu[R - 1][R - 1]);
+  } else {
+    Mat<R, R, T> lu = mat;
+    T result = static_cast<T>(1);
+    auto abs = [](T sca) { return sca < T{} ? -sca : sca; };
+    for (usize piv = 0; piv < R; ++piv) {
+      usize swp = piv;
+      for (usize col = piv + 1; col < R; ++col) if (abs(lu[swp][piv]) < abs(lu[col][piv])) swp = col;
+      if (lu[swp][piv] == T{}) return T{};
+      if (swp != piv) { std::swap(lu[piv], lu[swp]); result = -result; }
+      result *= lu[piv][piv];
+      for (usize col = piv + 1; col < R; ++col) {
+        T fac = lu[col][piv] / lu[piv][piv];
+        for (usize row = piv + 1; row < R; ++row) lu[col][row] -= fac * lu[piv][row];
+      }
+    }
+    return result;
+  }
+}
+template <typename T> constexpr T Determinant(Mat<1, 1, T> const& mat) { return mat[0][0]; }
+template <typename T> constexpr T Determinant(Mat<2, 2, T> const& mat) { return mat[0][0] * mat[1][1] - mat[1][0] * mat[0][1]; }
+template <typename T> constexpr T Determinant(Mat<3, 3, T> const& mat) {
+  return mat[0][0] * (mat[1][1] * mat[2][2] - mat[2][1] * mat[1][2])
+       - mat[1][0] * (mat[0][1] * mat[2][2] - mat[2][1] * mat[0][2])
+       + mat[2][0] * (mat[0][1] * mat[1][2] - mat[1][1] * mat[0][2]);
+}
+template <typename T> constexpr T Determinant(Mat<4, 4, T> const& mat) {
+  // Products of 2x2 minors taken from the first two and last two columns.
+  T sub0 = mat[0][0] * mat[1][1] - mat[1][0] * mat[0][1];
+  T sub1 = mat[0][0] * mat[1][2] - mat[1][0] * mat[0][2];
+  T sub2 = mat[0][0] * mat[1][3] - mat[1][0] * mat[0][3];
+  T sub3 = mat[0][1] * mat[1][2] - mat[1][1] * mat[0][2];
+  T sub4 = mat[0][1] * mat[1][3] - mat[1][1] * mat[0][3];
+  T sub5 = mat[0][2] * mat[1][3] - mat[1][2] * mat[0][3];
+  T cof0 = mat[2][0] * mat[3][1] - mat[3][0] * mat[2][1];
+  T cof1 = mat[2][0] * mat[3][2] - mat[3][0] * mat[2][2];
+  T cof2 = mat[2][0] * mat[3][3] - mat[3][0] * mat[2][3];
+  T cof3 = mat[2][1] * mat[3][2] - mat[3][1] * mat[2][2];
+  T cof4 = mat[2][1] * mat[3][3] - mat[3][1] * mat[2][3];
+  T cof5 = mat[2][2] * mat[3][3] - mat[3][2] * mat[2][3];
+  return sub0 * cof5 - sub1 * cof4 + sub2 * cof3 + sub3 * cof2 - sub4 * cof1 + sub5 * cof0;
+}
 
 template <usize R, typename T> constexpr Mat<R, R, T> CofactorMatrix(Mat<R, R, T> const& mat) { Mat<R, R, T> result{}; for (usize col = 0; col < R; ++col) for (usize row = 0; row < R; ++row) result[col][row] = Cofactor(mat, col, row); return result; }
 
-template <usize C, usize R, typename T> constexpr Mat<C, R, T> Transpose(Mat<R, C, T> const& mat) { return Mat<C, R, T>(mat.headr(), Transpose(mat.tailr())); }
-template          <usize R, typename T> constexpr Mat<1, R, T> Transpose(Mat<R, 1, T> const& mat) { return Mat<1, R, T>(mat.headr()); }
+template <usize C, usize R, typename T> constexpr Mat<C, R, T> Transpose(Mat<R, C, T> const& mat) { Mat<C, R, T> result; for (usize col = 0; col < C; ++col) for (usize row = 0; row < R; ++row) result[col][row] = mat[row][col]; return result; }
 
 template <usize R, typename T> constexpr Mat<R, R, T> Inverse(Mat<R, R, T> const& mat) { return static_cast<T>(1) / Determinant(mat) * Transpose(CofactorMatrix(mat)); }
+template <typename T> constexpr Mat<2, 2, T> Inverse(Mat<2, 2, T> const& mat) {
+  T inv = static_cast<T>(1) / Determinant(mat);
+  return Mat<2, 2, T>(mat[1][1] * inv, -mat[0][1] * inv, -mat[1][0] * inv, mat[0][0] * inv);
+}
+template <typename T> constexpr Mat<3, 3, T> Inverse(Mat<3, 3, T> const& mat) {
+  // Rows of the inverse are the pairwise cross products of the columns.
+  T crs00 = mat[1][1] * mat[2][2] - mat[1][2] * mat[2][1];
+  T crs01 = mat[1][2] * mat[2][0] - mat[1][0] * mat[2][2];
+  T crs02 = mat[1][0] * mat[2][1] - mat[1][1] * mat[2][0];
+  T crs10 = mat[2][1] * mat[0][2] - mat[2][2] * mat[0][1];
+  T crs11 = mat[2][2] * mat[0][0] - mat[2][0] * mat[0][2];
+  T crs12 = mat[2][0] * mat[0][1] - mat[2][1] * mat[0][0];
+  T crs20 = mat[0][1] * mat[1][2] - mat[0][2] * mat[1][1];
+  T crs21 = mat[0][2] * mat[1][0] - mat[0][0] * mat[1][2];
+  T crs22 = mat[0][0] * mat[1][1] - mat[0][1] * mat[1][0];
+  T inv   = static_cast<T>(1) / (mat[0][0] * crs00 + mat[0][1] * crs01 + mat[0][2] * crs02);
+  return Mat<3, 3, T>(crs00 * inv, crs10 * inv, crs20 * inv,
+                      crs01 * inv, crs11 * inv, crs21 * inv,
+                      crs02 * inv, crs12 * inv, crs22 * inv);
+}
+template <typename T> constexpr Mat<4, 4, T> Inverse(Mat<4, 4, T> const& mat) {
+  T sub0 = mat[0][0] * mat[1][1] - mat[1][0] * mat[0][1];
+  T sub1 = mat[0][0] * mat[1][2] - mat[1][0] * mat[0][2];
+  T sub2 = mat[0][0] * mat[1][3] - mat[1][0] * mat[0][3];
+  T sub3 = mat[0][1] * mat[1][2] - mat[1][1] * mat[0][2];
+  T sub4 = mat[0][1] * mat[1][3] - mat[1][1] * mat[0][3];
+  T sub5 = mat[0][2] * mat[1][3] - mat[1][2] * mat[0][3];
+  T cof0 = mat[2][0] * mat[3][1] - mat[3][0] * mat[2][1];
+  T cof1 = mat[2][0] * mat[3][2] - mat[3][0] * mat[2][2];
+  T cof2 = mat[2][0] * mat[3][3] - mat[3][0] * mat[2][3];
+  T cof3 = mat[2][1] * mat[3][2] - mat[3][1] * mat[2][2];
+  T cof4 = mat[2][1] * mat[3][3] - mat[3][1] * mat[2][3];
+  T cof5 = mat[2][2] * mat[3][3] - mat[3][2] * mat[2][3];
+  T inv  = static_cast<T>(1) / (sub0 * cof5 - sub1 * cof4 + sub2 * cof3 + sub3 * cof2 - sub4 * cof1 + sub5 * cof0);
+  return Mat<4, 4, T>(( mat[1][1] * cof5 - mat[1][2] * cof4 + mat[1][3] * cof3) * inv,
+                      (-mat[0][1] * cof5 + mat[0][2] * cof4 - mat[0][3] * cof3) * inv,
+                      ( mat[3][1] * sub5 - mat[3][2] * sub4 + mat[3][3] * sub3) * inv,
+                      (-mat[2][1] * sub5 + mat[2][2] * sub4 - mat[2][3] * sub3) * inv,
+                      (-mat[1][0] * cof5 + mat[1][2] * cof2 - mat[1][3] * cof1) * inv,
+                      ( mat[0][0] * cof5 - mat[0][2] * cof2 + mat[0][3] * cof1) * inv,
+                      (-mat[3][0] * sub5 + mat[3][2] * sub2 - mat[3][3] * sub1) * inv,
+                      ( mat[2][0] * sub5 - mat[2][2] * sub2 + mat[2][3] * sub1) * inv,
+                      ( mat[1][0] * cof4 - mat[1][1] * cof2 + mat[1][3] * cof0) * inv,
+                      (-mat[0][0] * cof4 + mat[0][1] * cof2 - mat[0][3] * cof0) * inv,
+                      ( mat[3][0] * sub4 - mat[3][1] * sub2 + mat[3][3] * sub0) * inv,
+                      (-mat[2][0] * sub4 + mat[2][1] * sub2 - mat[2][3] * sub0) * inv,
+                      (-mat[1][0] * cof3 + mat[1][1] * cof1 - mat[1][2] * cof0) * inv,
+                      ( mat[0][0] * cof3 - mat[0][1] * cof1 + mat[0][2] * cof0) * inv,
+                      (-mat[3][0] * sub3 + mat[3][1] * sub1 - mat[3][2] * sub0) * inv,
+                      ( mat[2][0] * sub3 - mat[2][1] * sub1 + mat[2][2] * sub0) * inv);
+}
 
 }  // namespace tf
 
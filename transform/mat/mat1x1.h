@@ -2,6 +2,7 @@
 #define TRANSFORM_MAT_MAT1X1_H_
 
 #include <cassert>
+#include <type_traits>
 
 #include "transform/types.h"
 #include "transform/mat/mat.h"
@@ -25,7 +26,7 @@ template <typename T> class Mat<C, R, T> {
 
  private:
   // --- Data ---
-  Vec<R, T> head_;
+  Vec<R, T> data_[C];
 
  public:
   // --- Component access ---
@@ -34,6 +35,9 @@ template <typename T> class Mat<C, R, T> {
   constexpr Vec<R, T> &      operator[]([[maybe_unused]] LengthType idx)       noexcept;
   constexpr Vec<R, T> const& operator[]([[maybe_unused]] LengthType idx) const noexcept;
 
+  constexpr T      * data()       noexcept;  // NOLINT(*-identifier-naming)
+  constexpr T const* data() const noexcept;  // NOLINT(*-identifier-naming)
+
   constexpr Vec<R, T> const& head() const noexcept;  // NOLINT(*-identifier-naming)
 
   constexpr void set_head(Vec<R, T> const& head) noexcept;  // NOLINT(*-identifier-naming)
@@ -44,7 +48,7 @@ template <typename T> class Mat<C, R, T> {
 
   // --- Implicit basic constructors ---
   constexpr Mat() noexcept;
-  constexpr Mat(Mat const& mat);
+  constexpr Mat(Mat const& mat)     = default;
   constexpr Mat(Mat&& mat) noexcept = default;
 
   // --- Explicit basic constructors ---
@@ -109,48 +113,55 @@ template <typename T> constexpr bool operator!=(Mat<C, R, T> const& mat1, Mat<C,
 // --- Alias ---
 template <typename T> using Mat1 = Mat<C, R, T>;
 
+// --- Layout ---
+static_assert(std::is_trivially_copyable_v<Mat<C, R, f32>> && std::is_standard_layout_v<Mat<C, R, f32>>);
+static_assert(std::is_trivially_copyable_v<Mat<C, R, f64>> && std::is_standard_layout_v<Mat<C, R, f64>>);
+static_assert(std::is_trivially_copyable_v<Mat<C, R, i32>> && std::is_standard_layout_v<Mat<C, R, i32>>);
+
 /************************
  * Function definitions *
  ************************/
 
 // --- Component access ---
-template <typename T> constexpr Vec<R, T> &      Mat<C, R, T>::operator[]([[maybe_unused]] LengthType idx)       noexcept { assert(idx < this->Length()); return this->head_; }
-template <typename T> constexpr Vec<R, T> const& Mat<C, R, T>::operator[]([[maybe_unused]] LengthType idx) const noexcept { assert(idx < this->Length()); return this->head_; }
+template <typename T> constexpr Vec<R, T> &      Mat<C, R, T>::operator[]([[maybe_unused]] LengthType idx)       noexcept { assert(idx < this->Length()); return this->data_[0]; }
+template <typename T> constexpr Vec<R, T> const& Mat<C, R, T>::operator[]([[maybe_unused]] LengthType idx) const noexcept { assert(idx < this->Length()); return this->data_[0]; }
+
+template <typename T> constexpr T      * Mat<C, R, T>::data()       noexcept { return this->data_[0].data(); }  // NOLINT(*-identifier-naming)
+template <typename T> constexpr T const* Mat<C, R, T>::data() const noexcept { return this->data_[0].data(); }  // NOLINT(*-identifier-naming)
 
-template <typename T> constexpr Vec<R, T> const& Mat<C, R, T>::head () const noexcept { return this->head_; }  // NOLINT(*-identifier-naming)
+template <typename T> constexpr Vec<R, T> const& Mat<C, R, T>::head () const noexcept { return this->data_[0]; }  // NOLINT(*-identifier-naming)
 
-template <typename T> constexpr void Mat<C, R, T>::set_head (Vec<R, T> const& head) noexcept { this->head_ = head; }  // NOLINT(*-identifier-naming)
+template <typename T> constexpr void Mat<C, R, T>::set_head (Vec<R, T> const& head) noexcept { this->data_[0] = head; }  // NOLINT(*-identifier-naming)
 
-template <typename T> constexpr Vec<C, T> Mat<C, R, T>::headr() const noexcept { return Vec<C, T>(this->head_.head()); }  // NOLINT(*-identifier-naming)
+template <typename T> constexpr Vec<C, T> Mat<C, R, T>::headr() const noexcept { return Vec<C, T>(this->data_[0].head()); }  // NOLINT(*-identifier-naming)
 
-template <typename T> constexpr void Mat<C, R, T>::set_headr(Vec<C, T> const& head) noexcept { this->head_.set_head(head.head()); }  // NOLINT(*-identifier-naming)
+template <typename T> constexpr void Mat<C, R, T>::set_headr(Vec<C, T> const& head) noexcept { this->data_[0].set_head(head.head()); }  // NOLINT(*-identifier-naming)
 
 // --- Implicit basic constructors ---
-template <typename T> constexpr Mat<C, R, T>::Mat() noexcept : head_() {}
-template <typename T> constexpr Mat<C, R, T>::Mat(Mat const& mat) : head_(mat.head_) {}
+template <typename T> constexpr Mat<C, R, T>::Mat() noexcept : data_() {}
 
 // --- Explicit basic constructors ---
-template <typename T> constexpr Mat<C, R, T>::Mat(T sca) noexcept : head_(sca) {}
+template <typename T> constexpr Mat<C, R, T>::Mat(T sca) noexcept : data_{Vec<R, T>(sca)} {}
 
 // --- Conversion constructors ---
-template <typename T> template <typename A> constexpr Mat<C, R, T>::Mat(A sca) noexcept : head_(static_cast<T>(sca)) {}
-template <typename T> template <typename A> constexpr Mat<C, R, T>::Mat(Vec<1, A> const& vec) noexcept : head_(static_cast<T>(vec.head())) {}
+template <typename T> template <typename A> constexpr Mat<C, R, T>::Mat(A sca) noexcept : data_{Vec<R, T>(static_cast<T>(sca))} {}
+template <typename T> template <typename A> constexpr Mat<C, R, T>::Mat(Vec<1, A> const& vec) noexcept : data_{Vec<R, T>(static_cast<T>(vec.head()))} {}
 
-template <typename T> template <usize N, usize M, typename A> constexpr Mat<C, R, T>::Mat(Mat<N, M, A> const& mat) noexcept : head_(mat.head()) {}
+template <typename T> template <usize N, usize M, typename A> constexpr Mat<C, R, T>::Mat(Mat<N, M, A> const& mat) noexcept : data_{Vec<R, T>(mat.head())} {}
 
 // --- Unary operators ---
-template <typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator=(Mat<C, R, U> const& mat) { this->head_ = mat.head(); return *this; };
+template <typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator=(Mat<C, R, U> const& mat) { this->data_[0] = mat.head(); return *this; };
 
-template <typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator+=(U sca) { this->head_ += sca; return *this; }
-template <typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator-=(U sca) { this->head_ -= sca; return *this; }
-template <typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator*=(U sca) { this->head_ *= sca; return *this; }
+template <typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator+=(U sca) { this->data_[0] += sca; return *this; }
+template <typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator-=(U sca) { this->data_[0] -= sca; return *this; }
+template <typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator*=(U sca) { this->data_[0] *= sca; return *this; }
 
-template <typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator+=(Mat<1, 1, U> const& mat) { this->head_ += mat.head(); return *this; }
-template <typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator-=(Mat<1, 1, U> const& mat) { this->head_ -= mat.head(); return *this; }
+template <typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator+=(Mat<1, 1, U> const& mat) { this->data_[0] += mat.head(); return *this; }
+template <typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator-=(Mat<1, 1, U> const& mat) { this->data_[0] -= mat.head(); return *this; }
 template <typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator*=(Mat<1, 1, U> const& mat) { return *this = *this * mat; }
 
-template <typename T> constexpr Mat<C, R, T>& Mat<C, R, T>::operator++() { ++this->head_; return *this; }
-template <typename T> constexpr Mat<C, R, T>& Mat<C, R, T>::operator--() { --this->head_; return *this; }
+template <typename T> constexpr Mat<C, R, T>& Mat<C, R, T>::operator++() { ++this->data_[0]; return *this; }
+template <typename T> constexpr Mat<C, R, T>& Mat<C, R, T>::operator--() { --this->data_[0]; return *this; }
 
 template <typename T> constexpr Mat<C, R, T> Mat<C, R, T>::operator++(int) { Mat<C, R, T> result(*this); ++(*this); return result; }
 template <typename T> constexpr Mat<C, R, T> Mat<C, R, T>::operator--(int) { Mat<C, R, T> result(*this); --(*this); return result; }
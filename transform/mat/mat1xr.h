@@ -2,6 +2,7 @@
 #define TRANSFORM_MAT_MAT1XR_H_
 
 #include <cassert>
+#include <type_traits>
 
 #include "transform/types.h"
 #include "transform/mat/mat1x1.h"
@@ -24,7 +25,18 @@ template <usize R, typename T> class Mat<C, R, T> {
 
  private:
   // --- Data ---
-  Vec<R, T> head_;
+  Vec<R, T> data_[C];
+
+  // --- Helpers ---
+  template                   <typename A> constexpr usize Insert(usize idx,              A         sca) noexcept;
+  template          <usize M, typename A> constexpr usize Insert(usize idx,    Vec<M, A> const& vec) noexcept;
+  template <usize N, usize M, typename A> constexpr usize Insert(usize idx, Mat<N, M, A> const& mat) noexcept;
+
+  // Number of elements the variadic constructors take from each argument.
+  template                   <typename A> static constexpr usize Count(std::type_identity<A>)            noexcept { return 1; }
+  template          <usize M, typename A> static constexpr usize Count(std::type_identity<Vec<M, A>>)    noexcept { return M; }
+  template <usize N, usize M, typename A> static constexpr usize Count(std::type_identity<Mat<N, M, A>>) noexcept { return N * M; }
+  template <typename... A>                static constexpr usize Count()                                 noexcept { return (Count(std::type_identity<A>()) + ...); }
 
  public:
   // --- Component access ---
@@ -33,6 +45,9 @@ template <usize R, typename T> class Mat<C, R, T> {
   constexpr Vec<R, T> &      operator[]([[maybe_unused]] LengthType idx)       noexcept;
   constexpr Vec<R, T> const& operator[]([[maybe_unused]] LengthType idx) const noexcept;
 
+  constexpr T      * data()       noexcept;  // NOLINT(*-identifier-naming)
+  constexpr T const* data() const noexcept;  // NOLINT(*-identifier-naming)
+
   constexpr Vec<R, T> const& head() const noexcept;  // NOLINT(*-identifier-naming)
 
   constexpr void set_head(Vec<R, T> const& head) noexcept;  // NOLINT(*-identifier-naming)
@@ -45,28 +60,17 @@ template <usize R, typename T> class Mat<C, R, T> {
 
   // --- Implicit basic constructors ---
   constexpr Mat() noexcept;
-  constexpr Mat(Mat const& mat);
+  constexpr Mat(Mat const& mat)     = default;
   constexpr Mat(Mat&& mat) noexcept = default;
 
   // --- Explicit basic constructors ---
   constexpr explicit Mat(T sca) noexcept;
 
   // --- Conversion constructors ---
-  template <typename U> explicit constexpr Mat(U sca) noexcept;
-  template <typename U, typename... V> explicit constexpr Mat(Vec<R, U> const& head, V /* unused */...) noexcept;
-
-  template                   <usize L, typename U, typename V, typename... W> requires (L < R) explicit constexpr Mat(Vec<L, U> const& head,           V         tail1, W... tail2) noexcept;
-  template                   <usize L, typename U, typename V, typename... W> requires (L < R) explicit constexpr Mat(Vec<L, U> const& head,    Vec<1, V> const& tail1, W... tail2) noexcept;
-  template          <usize M, usize L, typename U, typename V, typename... W> requires (L < R) explicit constexpr Mat(Vec<L, U> const& head,    Vec<M, V> const& tail1, W... tail2) noexcept;
-  template          <usize M, usize L, typename U, typename V, typename... W> requires (L < R) explicit constexpr Mat(Vec<L, U> const& head, Mat<1, M, V> const& tail1, W... tail2) noexcept;
-  template <usize N, usize M, usize L, typename U, typename V, typename... W> requires (L < R) explicit constexpr Mat(Vec<L, U> const& head, Mat<N, M, V> const& tail1, W... tail2) noexcept;
-
-  template                   <typename U, typename... V>                  explicit constexpr Mat(          U         head, V... tail) noexcept;
-  template          <usize M, typename U, typename... V> requires (M > R) explicit constexpr Mat(   Vec<M, U> const& head, V... tail) noexcept;
-  template          <usize M, typename U, typename... V>                  explicit constexpr Mat(Mat<1, M, U> const& head, V... tail) noexcept;
-  template <usize N, usize M, typename U, typename... V>                  explicit constexpr Mat(Mat<N, M, U> const& head, V... tail) noexcept;
-
-  // template <usize N, usize M, typename A> explicit constexpr Mat(Mat<N, M, A> const& mat) noexcept;
+  template                   <typename U>                 explicit constexpr Mat(             U         sca) noexcept;
+  template                   <typename U, typename... V> explicit constexpr Mat(             U         head, V const&... tail) noexcept requires (Count<           U, V...>() <= C * R);
+  template          <usize M, typename U, typename... V> explicit constexpr Mat(   Vec<M, U> const& head, V const&... tail) noexcept requires (Count<   Vec<M, U>, V...>() <= C * R);
+  template <usize N, usize M, typename U, typename... V> explicit constexpr Mat(Mat<N, M, U> const& head, V const&... tail) noexcept requires (Count<Mat<N, M, U>, V...>() <= C * R);
 
   // --- Destructor ---
   inline ~Mat() noexcept = default;
@@ -118,61 +122,62 @@ template          <usize R, typename T> constexpr Vec<C,    T> operator*(Vec<
 template <usize R, typename T> constexpr bool operator==(Mat<C, R, T> const& mat1, Mat<C, R, T> const& mat2);
 template <usize R, typename T> constexpr bool operator!=(Mat<C, R, T> const& mat1, Mat<C, R, T> const& mat2);
 
+// --- Layout ---
+static_assert(std::is_trivially_copyable_v<Mat<C, 4, f32>> && std::is_standard_layout_v<Mat<C, 4, f32>>);
+static_assert(std::is_trivially_copyable_v<Mat<C, 4, f64>> && std::is_standard_layout_v<Mat<C, 4, f64>>);
+static_assert(std::is_trivially_copyable_v<Mat<C, 4, i32>> && std::is_standard_layout_v<Mat<C, 4, i32>>);
+
 /************************
  * Function definitions *
  ************************/
 
 // --- Component access ---
-template <usize R, typename T> constexpr Vec<R, T> &      Mat<C, R, T>::operator[]([[maybe_unused]] LengthType idx)       noexcept { assert(idx < this->Length()); return this->head_; }
-template <usize R, typename T> constexpr Vec<R, T> const& Mat<C, R, T>::operator[]([[maybe_unused]] LengthType idx) const noexcept { assert(idx < this->Length()); return this->head_; }
+template <usize R, typename T> constexpr Vec<R, T> &      Mat<C, R, T>::operator[]([[maybe_unused]] LengthType idx)       noexcept { assert(idx < this->Length()); return this->data_[idx]; }
+template <usize R, typename T> constexpr Vec<R, T> const& Mat<C, R, T>::operator[]([[maybe_unused]] LengthType idx) const noexcept { assert(idx < this->Length()); return this->data_[idx]; }
+
+template <usize R, typename T> constexpr T      * Mat<C, R, T>::data()       noexcept { return this->data_[0].data(); }  // NOLINT(*-identifier-naming)
+template <usize R, typename T> constexpr T const* Mat<C, R, T>::data() const noexcept { return this->data_[0].data(); }  // NOLINT(*-identifier-naming)
 
-template <usize R, typename T> constexpr Vec<R, T> const& Mat<C, R, T>::head() const noexcept { return this->head_; }  // NOLINT(*-identifier-naming)
+template <usize R, typename T> constexpr Vec<R, T> const& Mat<C, R, T>::head() const noexcept { return this->data_[0]; }  // NOLINT(*-identifier-naming)
 
-template <usize R, typename T> constexpr void Mat<C, R, T>::set_head(Vec<R, T> const& head) noexcept { this->head_ = head; }  // NOLINT(*-identifier-naming)
+template <usize R, typename T> constexpr void Mat<C, R, T>::set_head(Vec<R, T> const& head) noexcept { this->data_[0] = head; }  // NOLINT(*-identifier-naming)
 
-template <usize R, typename T> constexpr Vec<C,        T> Mat<C, R, T>::headr() const noexcept { return Vec<C,        T>(this->head_.head()); }  // NOLINT(*-identifier-naming)
-template <usize R, typename T> constexpr Mat<C, R - 1, T> Mat<C, R, T>::tailr() const noexcept { return Mat<C, R - 1, T>(this->head_.tail()); }  // NOLINT(*-identifier-naming)
+template <usize R, typename T> constexpr Vec<C,        T> Mat<C, R, T>::headr() const noexcept { Vec<C,        T> result; for (LengthType idx = 0; idx < C; ++idx) result[idx] = this->data_[idx].head(); return result; }  // NOLINT(*-identifier-naming)
+template <usize R, typename T> constexpr Mat<C, R - 1, T> Mat<C, R, T>::tailr() const noexcept { Mat<C, R - 1, T> result; for (LengthType idx = 0; idx < C; ++idx) result[idx] = this->data_[idx].tail(); return result; }  // NOLINT(*-identifier-naming)
 
-template <usize R, typename T> constexpr void Mat<C, R, T>::set_headr(Vec<C,        T> const& head) noexcept { this->head_.set_head(head.head()); }  // NOLINT(*-identifier-naming)
-template <usize R, typename T> constexpr void Mat<C, R, T>::set_tailr(Mat<C, R - 1, T> const& tail) noexcept { this->head_.set_tail(tail.head()); }  // NOLINT(*-identifier-naming)
+template <usize R, typename T> constexpr void Mat<C, R, T>::set_headr(Vec<C,        T> const& head) noexcept { for (LengthType idx = 0; idx < C; ++idx) this->data_[idx].set_head(head[idx]); }  // NOLINT(*-identifier-naming)
+template <usize R, typename T> constexpr void Mat<C, R, T>::set_tailr(Mat<C, R - 1, T> const& tail) noexcept { for (LengthType idx = 0; idx < C; ++idx) this->data_[idx].set_tail(tail[idx]); }  // NOLINT(*-identifier-naming)
 
 // --- Implicit basic constructors ---
-template <usize R, typename T> constexpr Mat<C, R, T>::Mat() noexcept : head_() {}
-template <usize R, typename T> constexpr Mat<C, R, T>::Mat(Mat const& mat) : head_(mat.head_) {}
+template <usize R, typename T> constexpr Mat<C, R, T>::Mat() noexcept : data_() {}
 
 // --- Explicit basic constructors ---
-template <usize R, typename T> constexpr Mat<C, R, T>::Mat(T sca) noexcept : head_(sca) {}
+template <usize R, typename T> constexpr Mat<C, R, T>::Mat(T sca) noexcept : data_() { for (LengthType idx = 0; idx < C; ++idx) this->data_[idx] = Vec<R, T>(sca); }
 
 // --- Conversion constructors ---
-template <usize R, typename T> template <typename U> constexpr Mat<C, R, T>::Mat(U sca) noexcept : head_(static_cast<T>(sca)) {}
-template <usize R, typename T> template <typename U, typename... V> constexpr Mat<C, R, T>::Mat(Vec<R, U> const& head, V /* unused */...) noexcept : head_(head) {}
-
-template <usize R, typename T> template                   <usize L, typename U, typename V, typename... W> requires (L < R) constexpr Mat<C, R, T>::Mat(Vec<L, U> const& head,           V         tail1, W... tail2) noexcept : Mat(Vec<L + 1, U>(head , static_cast<U>(tail1       )),               tail2...) {}
-template <usize R, typename T> template                   <usize L, typename U, typename V, typename... W> requires (L < R) constexpr Mat<C, R, T>::Mat(Vec<L, U> const& head,    Vec<1, V> const& tail1, W... tail2) noexcept : Mat(Vec<L + 1, U>(head , static_cast<U>(tail1.head())),               tail2...) {}
-template <usize R, typename T> template          <usize M, usize L, typename U, typename V, typename... W> requires (L < R) constexpr Mat<C, R, T>::Mat(Vec<L, U> const& head,    Vec<M, V> const& tail1, W... tail2) noexcept : Mat(Vec<L + 1, U>(head , static_cast<U>(tail1.head())), tail1.tail(), tail2...) {}
-template <usize R, typename T> template          <usize M, usize L, typename U, typename V, typename... W> requires (L < R) constexpr Mat<C, R, T>::Mat(Vec<L, U> const& head, Mat<1, M, V> const& tail1, W... tail2) noexcept : Mat(Vec<L + 1, U>(head),                tail1.head()  ,               tail2...) {}
-template <usize R, typename T> template <usize N, usize M, usize L, typename U, typename V, typename... W> requires (L < R) constexpr Mat<C, R, T>::Mat(Vec<L, U> const& head, Mat<N, M, V> const& tail1, W... tail2) noexcept : Mat(Vec<L + 1, U>(head),                tail1.head()  , tail1.tail(), tail2...) {}
-
-template <usize R, typename T> template                   <typename U, typename... V>                  constexpr Mat<C, R, T>::Mat(          U         head, V... tail) noexcept : Mat(Vec<1, U>(head       ),              tail...) {}
-template <usize R, typename T> template          <usize M, typename U, typename... V> requires (M > R) constexpr Mat<C, R, T>::Mat(   Vec<M, U> const& head, V... tail) noexcept : Mat(Vec<1, U>(head.head()), head.tail(), tail...) {}
-template <usize R, typename T> template          <usize M, typename U, typename... V>                  constexpr Mat<C, R, T>::Mat(Mat<1, M, U> const& head, V... tail) noexcept : Mat(          head.head() ,              tail...) {}
-template <usize R, typename T> template <usize N, usize M, typename U, typename... V>                  constexpr Mat<C, R, T>::Mat(Mat<N, M, U> const& head, V... tail) noexcept : Mat(          head.head() , head.tail(), tail...) {}
+template <usize R, typename T> template                   <typename U>                 constexpr Mat<C, R, T>::Mat(             U         sca) noexcept : Mat(static_cast<T>(sca)) {}
+template <usize R, typename T> template                   <typename U, typename... V> constexpr Mat<C, R, T>::Mat(             U         head, V const&... tail) noexcept requires (Count<           U, V...>() <= C * R) : data_() { [[maybe_unused]] usize idx = this->Insert(0, head); ((idx = this->Insert(idx, tail)), ...); }
+template <usize R, typename T> template          <usize M, typename U, typename... V> constexpr Mat<C, R, T>::Mat(   Vec<M, U> const& head, V const&... tail) noexcept requires (Count<   Vec<M, U>, V...>() <= C * R) : data_() { [[maybe_unused]] usize idx = this->Insert(0, head); ((idx = this->Insert(idx, tail)), ...); }
+template <usize R, typename T> template <usize N, usize M, typename U, typename... V> constexpr Mat<C, R, T>::Mat(Mat<N, M, U> const& head, V const&... tail) noexcept requires (Count<Mat<N, M, U>, V...>() <= C * R) : data_() { [[maybe_unused]] usize idx = this->Insert(0, head); ((idx = this->Insert(idx, tail)), ...); }
 
-// template <usize R, typename T> template <usize N, usize M, typename A> constexpr Mat<C, R, T>::Mat(Mat<N, M, A> const& mat) noexcept : head_(mat.head()) {}
+// --- Helpers ---
+template <usize R, typename T> template                   <typename A> constexpr usize Mat<C, R, T>::Insert(usize idx,              A         sca) noexcept { assert(idx < C * R); this->data_[idx / R][idx % R] = static_cast<T>(sca); return idx + 1; }
+template <usize R, typename T> template          <usize M, typename A> constexpr usize Mat<C, R, T>::Insert(usize idx,    Vec<M, A> const& vec) noexcept { for (usize jdx = 0; jdx < M; ++jdx) idx = this->Insert(idx, vec[jdx]); return idx; }
+template <usize R, typename T> template <usize N, usize M, typename A> constexpr usize Mat<C, R, T>::Insert(usize idx, Mat<N, M, A> const& mat) noexcept { for (usize jdx = 0; jdx < N; ++jdx) idx = this->Insert(idx, mat[jdx]); return idx; }
 
 // --- Unary operators ---
-template <usize R, typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator=(Mat<C, R, U> const& mat) { this->head_ = mat.head(); return *this; };
+template <usize R, typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator=(Mat<C, R, U> const& mat) { for (LengthType idx = 0; idx < C; ++idx) this->data_[idx] = mat[idx]; return *this; };
 
-template <usize R, typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator+=(U sca) { this->head_ += sca; return *this; }
-template <usize R, typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator-=(U sca) { this->head_ -= sca; return *this; }
-template <usize R, typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator*=(U sca) { this->head_ *= sca; return *this; }
+template <usize R, typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator+=(U sca) { for (LengthType idx = 0; idx < C; ++idx) this->data_[idx] += sca; return *this; }
+template <usize R, typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator-=(U sca) { for (LengthType idx = 0; idx < C; ++idx) this->data_[idx] -= sca; return *this; }
+template <usize R, typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator*=(U sca) { for (LengthType idx = 0; idx < C; ++idx) this->data_[idx] *= sca; return *this; }
 
-template <usize R, typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator+=(Mat<C, R, U> const& mat) { this->head_ += mat.head(); return *this; }
-template <usize R, typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator-=(Mat<C, R, U> const& mat) { this->head_ -= mat.head(); return *this; }
+template <usize R, typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator+=(Mat<C, R, U> const& mat) { for (LengthType idx = 0; idx < C; ++idx) this->data_[idx] += mat[idx]; return *this; }
+template <usize R, typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator-=(Mat<C, R, U> const& mat) { for (LengthType idx = 0; idx < C; ++idx) this->data_[idx] -= mat[idx]; return *this; }
 template <usize R, typename T> template <typename U> constexpr Mat<C, R, T>& Mat<C, R, T>::operator*=(Mat<C, C, U> const& mat) { return *this = *this * mat; }
 
-template <usize R, typename T> constexpr Mat<C, R, T>& Mat<C, R, T>::operator++() { ++this->head_; return *this; }
-template <usize R, typename T> constexpr Mat<C, R, T>& Mat<C, R, T>::operator--() { --this->head_; return *this; }
+template <usize R, typename T> constexpr Mat<C, R, T>& Mat<C, R, T>::operator++() { for (LengthType idx = 0; idx < C; ++idx) ++this->data_[idx]; return *this; }
+template <usize R, typename T> constexpr Mat<C, R, T>& Mat<C, R, T>::operator--() { for (LengthType idx = 0; idx < C; ++idx) --this->data_[idx]; return *this; }
 
 template <usize R, typename T> constexpr Mat<C, R, T> Mat<C, R, T>::operator++(int) { Mat<C, R, T> result(*this); ++(*this); return result; }
 template <usize R, typename T> constexpr Mat<C, R, T> Mat<C, R, T>::operator--(int) { Mat<C, R, T> result(*this); --(*this); return result; }
@@ -194,7 +199,7 @@ template <usize R, typename T> constexpr Mat<C, R, T> operator+(Mat<C, R, T> con
 template <usize R, typename T> constexpr Mat<C, R, T> operator-(Mat<C, R, T> const& mat1, Mat<C, R, T> const& mat2) { return Mat<C, R, T>(mat1.head() - mat2.head()); }
 
 template <usize N, usize R, typename T> constexpr Mat<C, N, T> operator*(Mat<R, N, T> const& mat1, Mat<C, R, T> const& mat2) { return Mat<C, N, T>(   (mat1 * mat2.head())                     ); }
-template          <usize R, typename T> constexpr Vec<   R, T> operator*(Mat<C, R, T> const& mat1, Vec<C,    T> const& vec2) { return Vec<   R, T>(Dot(mat1.headr(), vec2), mat1.tailr() * vec2); }
+template          <usize R, typename T> constexpr Vec<   R, T> operator*(Mat<C, R, T> const& mat1, Vec<C,    T> const& vec2) { Vec<R, T> result = mat1[C - 1] * vec2[C - 1]; for (usize idx = C - 1; idx-- > 0;) result = mat1[idx] * vec2[idx] + result; return result; }
 template          <usize R, typename T> constexpr Vec<C,    T> operator*(Vec<   R, T> const& vec1, Mat<C, R, T> const& mat2) { return Vec<C,    T>(Dot(vec1,  mat2.head())                     ); }
 
 // --- Boolean operators ---
@@ -0,0 +1,40 @@
+#ifndef TRANSFORM_SIMD_CONFIG_H_
+#define TRANSFORM_SIMD_CONFIG_H_
+
+// The SIMD backend is opt-in: define TRANSFORM_SIMD (or configure with -DTRANSFORM_SIMD=ON) to replace the scalar
+// loops of the hot Vec and Mat specializations with intrinsics. Each instruction set is only used when the compiler
+// targets it, so the same headers build everywhere and fall back to the scalar templates.
+
+#if defined(TRANSFORM_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#define TRANSFORM_SIMD_SSE 1
+#endif
+
+#if defined(TRANSFORM_SIMD_SSE) && defined(__AVX__)
+#define TRANSFORM_SIMD_AVX 1
+#endif
+
+// AVX2 kernels fuse multiply and add, so they may differ from the scalar path in the last bit.
+#if defined(TRANSFORM_SIMD_SSE) && defined(__AVX2__) && defined(__FMA__)
+#define TRANSFORM_SIMD_AVX2 1
+#endif
+
+// Keeps a helper out of line. Inlined into a caller whose buffer is shorter than the helper's fixed width, GCC can
+// fail to prove the caller's size check and reports the skipped path under -Warray-bounds.
+#if defined(__GNUC__)
+#define TRANSFORM_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define TRANSFORM_NOINLINE __declspec(noinline)
+#else
+#define TRANSFORM_NOINLINE
+#endif
+
+// The portable backend (TRANSFORM_SIMD_PORTABLE) covers the generic Vec and Mat templates with std::experimental::simd,
+// which follows the target the compiler builds for. It needs the Parallelism TS header (libstdc++ 11 and newer) and
+// turns itself off where the header is missing.
+#if defined(TRANSFORM_SIMD_PORTABLE) && defined(__has_include)
+#if __has_include(<experimental/simd>)
+#define TRANSFORM_SIMD_PORTABLE_STDX 1
+#endif
+#endif
+
+#endif  // TRANSFORM_SIMD_CONFIG_H_
@@ -0,0 +1,292 @@
+#ifndef TRANSFORM_SIMD_MAT4_H_
+#define TRANSFORM_SIMD_MAT4_H_
+
+#include "transform/simd/config.h"
+
+#ifdef TRANSFORM_SIMD_SSE
+
+#include <cstdint>
+#include <type_traits>
+
+#include <immintrin.h>
+
+#include "transform/types.h"
+#include "transform/mat/func.h"
+#include "transform/mat/matcxr.h"
+#include "transform/simd/soa.h"
+#include "transform/simd/vec4.h"
+
+namespace tf {
+
+namespace simd {
+
+// Column-major 4x4 kernels over raw storage. Each result column is the right fold
+// lhs[3] * rhs[3] + ... + lhs[0] * rhs[0], the same order as the scalar Mat * Vec.
+// kStream writes `out` with non-temporal stores, which need it 16-byte aligned.
+template <bool kStream = false> inline void MulSse(f32 const* lhs, f32 const* rhs, f32* out) noexcept;
+#ifdef TRANSFORM_SIMD_AVX2
+template <bool kStream = false> inline void MulAvx2(f32 const* lhs, f32 const* rhs, f32* out) noexcept;
+#endif
+
+// lhs[idx] * rhs[idx] for `count` consecutive matrices, or one lhs against every rhs when `lhs_step` is 0 (16
+// otherwise). The products are those of Mat4 * Mat4. Once the output outgrows kStreamBytes (about an L2 cache), inputs
+// are prefetched kMulPrefetch matrices ahead and `out` goes around the cache with non-temporal stores, if it is 16-byte
+// aligned. `out` may be either input array itself, but must not partly overlap it.
+inline constexpr usize kMulPrefetch = 8;
+inline constexpr usize kStreamBytes = usize{1} << 21;
+inline void MulBatch(f32 const* lhs, usize lhs_step, f32 const* rhs, f32* out, usize count) noexcept;
+
+// Mat * Vec as a linear combination of the columns, and Vec * Mat as four dot products summed
+// after a transpose. Both follow the scalar folds; the column form uses FMA alongside MulAvx2.
+inline __m128 MulColumns(f32 const* mat, __m128 vec) noexcept;
+inline __m128 MulRows   (__m128 vec, f32 const* mat) noexcept;
+
+// The twelve 2x2 minors and the reciprocal determinant of `tf::Inverse`, in the same order, so the
+// vectorized cofactors below stay bit-identical to the scalar closed form.
+template <typename T> struct InverseMinors {
+  T sub[6];
+  T cof[6];
+  T inv;
+};
+template <typename T> inline InverseMinors<T> ComputeInverseMinors(T const* mat) noexcept;
+
+inline void InverseSse(f32 const* mat, f32* out) noexcept;
+
+// A Mat4 applied to packed Vec3 as points (w = 1), directions (w = 0) or points followed by the perspective divide,
+// and a Mat3 (kStride = 3) applied to normals followed by an exact or reciprocal square root renormalization. Four
+// elements per step in x/y/z lanes, with the matrix entries broadcast once per batch. Returns how many leading
+// elements were handled, a multiple of four; `src` and `dst` may be the same array.
+enum class Apply : u8 { kPoint, kVector, kProjective, kNormal, kNormalFast };
+inline __m128 MulAdd(__m128 lhs, __m128 rhs, __m128 acc) noexcept;
+template <Apply kApply, usize kStride = 4> inline usize TransformBatch(f32 const* mat, Vec<3, f32> const* src, Vec<3, f32>* dst, usize count) noexcept;
+
+}  // namespace simd
+
+// --- Binary arithmetic operators ---
+constexpr Mat<4, 4, f32> operator*(Mat<4, 4, f32> const& mat1, Mat<4, 4, f32> const& mat2);
+constexpr Vec<4,    f32> operator*(Mat<4, 4, f32> const& mat1, Vec<4,    f32> const& vec2);
+constexpr Vec<4,    f32> operator*(Vec<4,    f32> const& vec1, Mat<4, 4, f32> const& mat2);
+
+// --- Functions ---
+constexpr Mat<4, 4, f32> Inverse(Mat<4, 4, f32> const& mat);
+
+/************************
+ * Function definitions *
+ ************************/
+
+namespace simd {
+
+template <bool kStream> inline void MulSse(f32 const* lhs, f32 const* rhs, f32* out) noexcept {
+  __m128 col0 = _mm_loadu_ps(lhs + 0);
+  __m128 col1 = _mm_loadu_ps(lhs + 4);
+  __m128 col2 = _mm_loadu_ps(lhs + 8);
+  __m128 col3 = _mm_loadu_ps(lhs + 12);
+  for (usize idx = 0; idx < 16; idx += 4) {
+    __m128 res = _mm_mul_ps(col3, _mm_set1_ps(rhs[idx + 3]));
+    res        = _mm_add_ps(_mm_mul_ps(col2, _mm_set1_ps(rhs[idx + 2])), res);
+    res        = _mm_add_ps(_mm_mul_ps(col1, _mm_set1_ps(rhs[idx + 1])), res);
+    res        = _mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(rhs[idx + 0])), res);
+    if constexpr (kStream) _mm_stream_ps(out + idx, res);
+    else                   _mm_storeu_ps(out + idx, res);
+  }
+}
+
+#ifdef TRANSFORM_SIMD_AVX2
+// Two result columns per iteration: each lhs column is duplicated into both halves, and the
+// in-lane shuffles splat the matching rhs components of two columns at once.
+template <bool kStream> inline void MulAvx2(f32 const* lhs, f32 const* rhs, f32* out) noexcept {
+  __m256 col0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(lhs + 0));
+  __m256 col1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(lhs + 4));
+  __m256 col2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(lhs + 8));
+  __m256 col3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(lhs + 12));
+  for (usize idx = 0; idx < 16; idx += 8) {
+    __m256 vec = _mm256_loadu_ps(rhs + idx);
+    __m256 res = _mm256_mul_ps(col3, _mm256_shuffle_ps(vec, vec, _MM_SHUFFLE(3, 3, 3, 3)));
+    res        = _mm256_fmadd_ps(col2, _mm256_shuffle_ps(vec, vec, _MM_SHUFFLE(2, 2, 2, 2)), res);
+    res        = _mm256_fmadd_ps(col1, _mm256_shuffle_ps(vec, vec, _MM_SHUFFLE(1, 1, 1, 1)), res);
+    res        = _mm256_fmadd_ps(col0, _mm256_shuffle_ps(vec, vec, _MM_SHUFFLE(0, 0, 0, 0)), res);
+    if constexpr (kStream) {
+      // Two 16-byte halves, so that arrays from malloc qualify as well.
+      _mm_stream_ps(out + idx,     _mm256_castps256_ps128(res));
+      _mm_stream_ps(out + idx + 4, _mm256_extractf128_ps(res, 1));
+    } else {
+      _mm256_storeu_ps(out + idx, res);
+    }
+  }
+}
+#endif
+
+// Each Mat4 is one cache line when the array is 64-byte aligned and straddles two otherwise, so both ends of the
+// matrix kMulPrefetch ahead are touched. Streamed stores are fenced before returning, so they order like plain ones.
+inline void MulBatch(f32 const* lhs, usize lhs_step, f32 const* rhs, f32* out, usize count) noexcept {
+  auto const run = [&]<bool kPrefetch, bool kStream>() {
+    for (usize idx = 0; idx < count; ++idx, lhs += lhs_step, rhs += 16, out += 16) {
+      if (kPrefetch && idx + kMulPrefetch < count) {
+        _mm_prefetch(reinterpret_cast<char const*>(rhs + 16 * kMulPrefetch), _MM_HINT_T0);
+        _mm_prefetch(reinterpret_cast<char const*>(rhs + 16 * kMulPrefetch + 15), _MM_HINT_T0);
+        if (lhs_step != 0) {
+          _mm_prefetch(reinterpret_cast<char const*>(lhs + lhs_step * kMulPrefetch), _MM_HINT_T0);
+          _mm_prefetch(reinterpret_cast<char const*>(lhs + lhs_step * kMulPrefetch + 15), _MM_HINT_T0);
+        }
+      }
+#ifdef TRANSFORM_SIMD_AVX2
+      MulAvx2<kStream>(lhs, rhs, out);
+#else
+      MulSse<kStream>(lhs, rhs, out);
+#endif
+    }
+  };
+  if (count * 16 * sizeof(f32) <= kStreamBytes) {
+    run.template operator()<false, false>();
+  } else if (reinterpret_cast<std::uintptr_t>(out) % 16 != 0) {
+    run.template operator()<true, false>();
+  } else {
+    run.template operator()<true, true>();
+    _mm_sfence();
+  }
+}
+
+inline __m128 MulColumns(f32 const* mat, __m128 vec) noexcept {
+#ifdef TRANSFORM_SIMD_AVX2
+  __m128 res = _mm_mul_ps(_mm_loadu_ps(mat + 12), _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(3, 3, 3, 3)));
+  res        = _mm_fmadd_ps(_mm_loadu_ps(mat + 8), _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(2, 2, 2, 2)), res);
+  res        = _mm_fmadd_ps(_mm_loadu_ps(mat + 4), _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(1, 1, 1, 1)), res);
+  return       _mm_fmadd_ps(_mm_loadu_ps(mat + 0), _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(0, 0, 0, 0)), res);
+#else
+  __m128 res = _mm_mul_ps(_mm_loadu_ps(mat + 12), _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(3, 3, 3, 3)));
+  res        = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(mat + 8), _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(2, 2, 2, 2))), res);
+  res        = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(mat + 4), _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(1, 1, 1, 1))), res);
+  return       _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(mat + 0), _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(0, 0, 0, 0))), res);
+#endif
+}
+
+inline __m128 MulRows(__m128 vec, f32 const* mat) noexcept {
+  __m128 prd0 = _mm_mul_ps(vec, _mm_loadu_ps(mat + 0));
+  __m128 prd1 = _mm_mul_ps(vec, _mm_loadu_ps(mat + 4));
+  __m128 prd2 = _mm_mul_ps(vec, _mm_loadu_ps(mat + 8));
+  __m128 prd3 = _mm_mul_ps(vec, _mm_loadu_ps(mat + 12));
+  _MM_TRANSPOSE4_PS(prd0, prd1, prd2, prd3);
+  return _mm_add_ps(prd0, _mm_add_ps(prd1, _mm_add_ps(prd2, prd3)));
+}
+
+template <typename T> inline InverseMinors<T> ComputeInverseMinors(T const* mat) noexcept {
+  InverseMinors<T> res;
+  res.sub[0] = mat[0] * mat[5] - mat[4] * mat[1];
+  res.sub[1] = mat[0] * mat[6] - mat[4] * mat[2];
+  res.sub[2] = mat[0] * mat[7] - mat[4] * mat[3];
+  res.sub[3] = mat[1] * mat[6] - mat[5] * mat[2];
+  res.sub[4] = mat[1] * mat[7] - mat[5] * mat[3];
+  res.sub[5] = mat[2] * mat[7] - mat[6] * mat[3];
+  res.cof[0] = mat[8] * mat[13] - mat[12] * mat[9];
+  res.cof[1] = mat[8] * mat[14] - mat[12] * mat[10];
+  res.cof[2] = mat[8] * mat[15] - mat[12] * mat[11];
+  res.cof[3] = mat[9] * mat[14] - mat[13] * mat[10];
+  res.cof[4] = mat[9] * mat[15] - mat[13] * mat[11];
+  res.cof[5] = mat[10] * mat[15] - mat[14] * mat[11];
+  res.inv    = static_cast<T>(1) / (res.sub[0] * res.cof[5] - res.sub[1] * res.cof[4] + res.sub[2] * res.cof[3] + res.sub[3] * res.cof[2] - res.sub[4] * res.cof[1] + res.sub[5] * res.cof[0]);
+  return res;
+}
+
+// Lane j of `row_k` holds component k of column (1, 0, 3, 2)[j]. Every cofactor column is then
+// three products of such a row with broadcast minors, and the alternating signs fold into the
+// reciprocal determinant.
+inline void InverseSse(f32 const* mat, f32* out) noexcept {
+  InverseMinors<f32> min = ComputeInverseMinors(mat);
+  __m128 row0 = _mm_loadu_ps(mat + 4);
+  __m128 row1 = _mm_loadu_ps(mat + 0);
+  __m128 row2 = _mm_loadu_ps(mat + 12);
+  __m128 row3 = _mm_loadu_ps(mat + 8);
+  _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+  __m128 min0 = _mm_setr_ps(min.cof[0], min.cof[0], min.sub[0], min.sub[0]);
+  __m128 min1 = _mm_setr_ps(min.cof[1], min.cof[1], min.sub[1], min.sub[1]);
+  __m128 min2 = _mm_setr_ps(min.cof[2], min.cof[2], min.sub[2], min.sub[2]);
+  __m128 min3 = _mm_setr_ps(min.cof[3], min.cof[3], min.sub[3], min.sub[3]);
+  __m128 min4 = _mm_setr_ps(min.cof[4], min.cof[4], min.sub[4], min.sub[4]);
+  __m128 min5 = _mm_setr_ps(min.cof[5], min.cof[5], min.sub[5], min.sub[5]);
+  __m128 sgn0 = _mm_setr_ps( min.inv, -min.inv,  min.inv, -min.inv);
+  __m128 sgn1 = _mm_setr_ps(-min.inv,  min.inv, -min.inv,  min.inv);
+  _mm_storeu_ps(out + 0,  _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(row1, min5), _mm_mul_ps(row2, min4)), _mm_mul_ps(row3, min3)), sgn0));
+  _mm_storeu_ps(out + 4,  _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(row0, min5), _mm_mul_ps(row2, min2)), _mm_mul_ps(row3, min1)), sgn1));
+  _mm_storeu_ps(out + 8,  _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(row0, min4), _mm_mul_ps(row1, min2)), _mm_mul_ps(row3, min0)), sgn0));
+  _mm_storeu_ps(out + 12, _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(row0, min3), _mm_mul_ps(row1, min1)), _mm_mul_ps(row2, min0)), sgn1));
+}
+
+inline __m128 MulAdd(__m128 lhs, __m128 rhs, __m128 acc) noexcept {
+#ifdef TRANSFORM_SIMD_AVX2
+  return _mm_fmadd_ps(lhs, rhs, acc);
+#else
+  return _mm_add_ps(_mm_mul_ps(lhs, rhs), acc);
+#endif
+}
+
+template <Apply kApply, usize kStride> inline usize TransformBatch(f32 const* mat, Vec<3, f32> const* src, Vec<3, f32>* dst, usize count) noexcept {
+  static_assert(sizeof(Vec<3, f32>) == 3 * sizeof(f32));
+  constexpr bool  kUnit = kApply == Apply::kNormal || kApply == Apply::kNormalFast;
+  constexpr usize kCols = kApply == Apply::kVector || kUnit ? 3 : 4;
+  constexpr usize kRows = kApply == Apply::kProjective ? 4 : 3;
+  __m128 cols[kCols][kRows];
+  for (usize col = 0; col < kCols; ++col)
+    for (usize row = 0; row < kRows; ++row) cols[col][row] = _mm_set1_ps(mat[kStride * col + row]);
+  usize const end = count & ~usize{3};
+  for (usize idx = 0; idx < end; idx += 4) {
+    __m128 xs, ys, zs;
+    Load3(src[idx].data(), xs, ys, zs);
+    __m128 res[kRows];
+    for (usize row = 0; row < kRows; ++row) {
+      __m128 acc;
+      if constexpr (kCols == 4) acc = MulAdd(cols[2][row], zs, cols[3][row]);
+      else                      acc = _mm_mul_ps(cols[2][row], zs);
+      res[row] = MulAdd(cols[0][row], xs, MulAdd(cols[1][row], ys, acc));
+    }
+    if constexpr (kApply == Apply::kProjective)
+      for (usize row = 0; row < 3; ++row) res[row] = _mm_div_ps(res[row], res[3]);
+    if constexpr (kUnit) {
+      __m128 dot = MulAdd(res[0], res[0], MulAdd(res[1], res[1], _mm_mul_ps(res[2], res[2])));
+      if constexpr (kApply == Apply::kNormalFast) {
+        __m128 inv = InverseSqrtFast(dot);
+        for (usize row = 0; row < 3; ++row) res[row] = _mm_mul_ps(res[row], inv);
+      } else {
+        __m128 len = _mm_sqrt_ps(dot);
+        for (usize row = 0; row < 3; ++row) res[row] = _mm_div_ps(res[row], len);
+      }
+    }
+    Store3(res[0], res[1], res[2], dst[idx].data());
+  }
+  return end;
+}
+
+}  // namespace simd
+
+// --- Binary arithmetic operators ---
+constexpr Mat<4, 4, f32> operator*(Mat<4, 4, f32> const& mat1, Mat<4, 4, f32> const& mat2) {
+  if (std::is_constant_evaluated()) return operator*<4, 4, 4, f32>(mat1, mat2);
+  Mat<4, 4, f32> result;
+#ifdef TRANSFORM_SIMD_AVX2
+  simd::MulAvx2(mat1.data(), mat2.data(), result.data());
+#else
+  simd::MulSse(mat1.data(), mat2.data(), result.data());
+#endif
+  return result;
+}
+constexpr Vec<4, f32> operator*(Mat<4, 4, f32> const& mat1, Vec<4, f32> const& vec2) {
+  if (std::is_constant_evaluated()) return operator*<4, 4, f32>(mat1, vec2);
+  return simd::Store(simd::MulColumns(mat1.data(), simd::Load(vec2)));
+}
+constexpr Vec<4, f32> operator*(Vec<4, f32> const& vec1, Mat<4, 4, f32> const& mat2) {
+  if (std::is_constant_evaluated()) return operator*<4, 4, f32>(vec1, mat2);
+  return simd::Store(simd::MulRows(simd::Load(vec1), mat2.data()));
+}
+
+// --- Functions ---
+constexpr Mat<4, 4, f32> Inverse(Mat<4, 4, f32> const& mat) {
+  if (std::is_constant_evaluated()) return Inverse<f32>(mat);
+  Mat<4, 4, f32> result;
+  simd::InverseSse(mat.data(), result.data());
+  return result;
+}
+
+}  // namespace tf
+
+#endif  // TRANSFORM_SIMD_SSE
+
+#endif  // TRANSFORM_SIMD_MAT4_H_
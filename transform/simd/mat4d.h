@@ -0,0 +1,138 @@
+#ifndef TRANSFORM_SIMD_MAT4D_H_
+#define TRANSFORM_SIMD_MAT4D_H_
+
+#include "transform/simd/config.h"
+
+#ifdef TRANSFORM_SIMD_AVX
+
+#include <type_traits>
+
+#include <immintrin.h>
+
+#include "transform/types.h"
+#include "transform/mat/func.h"
+#include "transform/mat/matcxr.h"
+#include "transform/simd/mat4.h"
+#include "transform/simd/vec4d.h"
+
+namespace tf {
+
+namespace simd {
+
+// The Mat<4, 4, f64> counterparts of the f32 kernels, one __m256d per column. They follow the
+// same folds, and fuse multiply-add under the same condition as MulAvx2.
+inline __m256d MulColumns(f64 const* mat, f64 const* vec) noexcept;
+inline __m256d MulRows   (__m256d vec, f64 const* mat) noexcept;
+inline void    MulAvx    (f64 const* lhs, f64 const* rhs, f64* out) noexcept;
+inline void    InverseAvx(f64 const* mat, f64* out) noexcept;
+
+}  // namespace simd
+
+// --- Binary arithmetic operators ---
+constexpr Mat<4, 4, f64> operator*(Mat<4, 4, f64> const& mat1, Mat<4, 4, f64> const& mat2);
+constexpr Vec<4,    f64> operator*(Mat<4, 4, f64> const& mat1, Vec<4,    f64> const& vec2);
+constexpr Vec<4,    f64> operator*(Vec<4,    f64> const& vec1, Mat<4, 4, f64> const& mat2);
+
+// --- Functions ---
+constexpr Mat<4, 4, f64> Inverse(Mat<4, 4, f64> const& mat);
+
+/************************
+ * Function definitions *
+ ************************/
+
+namespace simd {
+
+inline __m256d MulColumns(f64 const* mat, f64 const* vec) noexcept {
+#ifdef TRANSFORM_SIMD_AVX2
+  __m256d res = _mm256_mul_pd(_mm256_loadu_pd(mat + 12), _mm256_broadcast_sd(vec + 3));
+  res         = _mm256_fmadd_pd(_mm256_loadu_pd(mat + 8), _mm256_broadcast_sd(vec + 2), res);
+  res         = _mm256_fmadd_pd(_mm256_loadu_pd(mat + 4), _mm256_broadcast_sd(vec + 1), res);
+  return        _mm256_fmadd_pd(_mm256_loadu_pd(mat + 0), _mm256_broadcast_sd(vec + 0), res);
+#else
+  __m256d res = _mm256_mul_pd(_mm256_loadu_pd(mat + 12), _mm256_broadcast_sd(vec + 3));
+  res         = _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(mat + 8), _mm256_broadcast_sd(vec + 2)), res);
+  res         = _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(mat + 4), _mm256_broadcast_sd(vec + 1)), res);
+  return        _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(mat + 0), _mm256_broadcast_sd(vec + 0)), res);
+#endif
+}
+
+inline __m256d MulRows(__m256d vec, f64 const* mat) noexcept {
+  __m256d prd0 = _mm256_mul_pd(vec, _mm256_loadu_pd(mat + 0));
+  __m256d prd1 = _mm256_mul_pd(vec, _mm256_loadu_pd(mat + 4));
+  __m256d prd2 = _mm256_mul_pd(vec, _mm256_loadu_pd(mat + 8));
+  __m256d prd3 = _mm256_mul_pd(vec, _mm256_loadu_pd(mat + 12));
+  __m256d lo01 = _mm256_unpacklo_pd(prd0, prd1);
+  __m256d hi01 = _mm256_unpackhi_pd(prd0, prd1);
+  __m256d lo23 = _mm256_unpacklo_pd(prd2, prd3);
+  __m256d hi23 = _mm256_unpackhi_pd(prd2, prd3);
+  __m256d sum0 = _mm256_permute2f128_pd(lo01, lo23, 0x20);
+  __m256d sum1 = _mm256_permute2f128_pd(hi01, hi23, 0x20);
+  __m256d sum2 = _mm256_permute2f128_pd(lo01, lo23, 0x31);
+  __m256d sum3 = _mm256_permute2f128_pd(hi01, hi23, 0x31);
+  return _mm256_add_pd(sum0, _mm256_add_pd(sum1, _mm256_add_pd(sum2, sum3)));
+}
+
+inline void MulAvx(f64 const* lhs, f64 const* rhs, f64* out) noexcept {
+  for (usize idx = 0; idx < 16; idx += 4) _mm256_storeu_pd(out + idx, MulColumns(lhs, rhs + idx));
+}
+
+// Same layout as InverseSse: lane j of `row_k` holds component k of column (1, 0, 3, 2)[j].
+inline void InverseAvx(f64 const* mat, f64* out) noexcept {
+  InverseMinors<f64> min = ComputeInverseMinors(mat);
+  __m256d col0 = _mm256_loadu_pd(mat + 0);
+  __m256d col1 = _mm256_loadu_pd(mat + 4);
+  __m256d col2 = _mm256_loadu_pd(mat + 8);
+  __m256d col3 = _mm256_loadu_pd(mat + 12);
+  __m256d lo10 = _mm256_unpacklo_pd(col1, col0);
+  __m256d hi10 = _mm256_unpackhi_pd(col1, col0);
+  __m256d lo32 = _mm256_unpacklo_pd(col3, col2);
+  __m256d hi32 = _mm256_unpackhi_pd(col3, col2);
+  __m256d row0 = _mm256_permute2f128_pd(lo10, lo32, 0x20);
+  __m256d row1 = _mm256_permute2f128_pd(hi10, hi32, 0x20);
+  __m256d row2 = _mm256_permute2f128_pd(lo10, lo32, 0x31);
+  __m256d row3 = _mm256_permute2f128_pd(hi10, hi32, 0x31);
+  __m256d min0 = _mm256_setr_pd(min.cof[0], min.cof[0], min.sub[0], min.sub[0]);
+  __m256d min1 = _mm256_setr_pd(min.cof[1], min.cof[1], min.sub[1], min.sub[1]);
+  __m256d min2 = _mm256_setr_pd(min.cof[2], min.cof[2], min.sub[2], min.sub[2]);
+  __m256d min3 = _mm256_setr_pd(min.cof[3], min.cof[3], min.sub[3], min.sub[3]);
+  __m256d min4 = _mm256_setr_pd(min.cof[4], min.cof[4], min.sub[4], min.sub[4]);
+  __m256d min5 = _mm256_setr_pd(min.cof[5], min.cof[5], min.sub[5], min.sub[5]);
+  __m256d sgn0 = _mm256_setr_pd( min.inv, -min.inv,  min.inv, -min.inv);
+  __m256d sgn1 = _mm256_setr_pd(-min.inv,  min.inv, -min.inv,  min.inv);
+  _mm256_storeu_pd(out + 0,  _mm256_mul_pd(_mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(row1, min5), _mm256_mul_pd(row2, min4)), _mm256_mul_pd(row3, min3)), sgn0));
+  _mm256_storeu_pd(out + 4,  _mm256_mul_pd(_mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(row0, min5), _mm256_mul_pd(row2, min2)), _mm256_mul_pd(row3, min1)), sgn1));
+  _mm256_storeu_pd(out + 8,  _mm256_mul_pd(_mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(row0, min4), _mm256_mul_pd(row1, min2)), _mm256_mul_pd(row3, min0)), sgn0));
+  _mm256_storeu_pd(out + 12, _mm256_mul_pd(_mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(row0, min3), _mm256_mul_pd(row1, min1)), _mm256_mul_pd(row2, min0)), sgn1));
+}
+
+}  // namespace simd
+
+// --- Binary arithmetic operators ---
+constexpr Mat<4, 4, f64> operator*(Mat<4, 4, f64> const& mat1, Mat<4, 4, f64> const& mat2) {
+  if (std::is_constant_evaluated()) return operator*<4, 4, 4, f64>(mat1, mat2);
+  Mat<4, 4, f64> result;
+  simd::MulAvx(mat1.data(), mat2.data(), result.data());
+  return result;
+}
+constexpr Vec<4, f64> operator*(Mat<4, 4, f64> const& mat1, Vec<4, f64> const& vec2) {
+  if (std::is_constant_evaluated()) return operator*<4, 4, f64>(mat1, vec2);
+  return simd::Store(simd::MulColumns(mat1.data(), vec2.data()));
+}
+constexpr Vec<4, f64> operator*(Vec<4, f64> const& vec1, Mat<4, 4, f64> const& mat2) {
+  if (std::is_constant_evaluated()) return operator*<4, 4, f64>(vec1, mat2);
+  return simd::Store(simd::MulRows(simd::Load(vec1), mat2.data()));
+}
+
+// --- Functions ---
+constexpr Mat<4, 4, f64> Inverse(Mat<4, 4, f64> const& mat) {
+  if (std::is_constant_evaluated()) return Inverse<f64>(mat);
+  Mat<4, 4, f64> result;
+  simd::InverseAvx(mat.data(), result.data());
+  return result;
+}
+
+}  // namespace tf
+
+#endif  // TRANSFORM_SIMD_AVX
+
+#endif  // TRANSFORM_SIMD_MAT4D_H_
@@ -0,0 +1,60 @@
+#ifndef TRANSFORM_SIMD_MATCXR_H_
+#define TRANSFORM_SIMD_MATCXR_H_
+
+#include "transform/simd/config.h"
+
+#ifdef TRANSFORM_SIMD_PORTABLE_STDX
+
+#include <type_traits>
+
+#include "transform/types.h"
+#include "transform/mat/matcxr.h"
+#include "transform/simd/vecn.h"
+
+namespace tf {
+
+// Portable overloads for the element-wise arithmetic operators of `transform/mat/matcxr.h` (unary -, + - * with a
+// scalar, and + - between matrices); the compound assignments and increments stay the generic column loops. The columns
+// are contiguous, so a matrix is handled as one flat array of C * R elements instead of C column operations. Constant
+// evaluation goes column by column, as the flat array spans several subobjects there. Products keep the column
+// formulation of the generic templates and pick up the Vec overloads.
+
+// --- Unary operators ---
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator-(Mat<C, R, T> const& mat);
+
+// --- Binary operators ---
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator+(Mat<C, R, T> const& mat1, T sca2);
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator-(Mat<C, R, T> const& mat1, T sca2);
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator*(Mat<C, R, T> const& mat1, T sca2);
+
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator+(T sca1, Mat<C, R, T> const& mat2);
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator-(T sca1, Mat<C, R, T> const& mat2);
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator*(T sca1, Mat<C, R, T> const& mat2);
+
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator+(Mat<C, R, T> const& mat1, Mat<C, R, T> const& mat2);
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator-(Mat<C, R, T> const& mat1, Mat<C, R, T> const& mat2);
+
+/************************
+ * Function definitions *
+ ************************/
+
+// --- Unary operators ---
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator-(Mat<C, R, T> const& mat) { Mat<C, R, T> result; if (std::is_constant_evaluated()) for (usize idx = 0; idx < C; ++idx) result[idx] = -mat[idx]; else simd::Map<C * R>(mat.data(), result.data(), [](auto lane) { return -lane; }); return result; }
+
+// --- Binary operators ---
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator+(Mat<C, R, T> const& mat1, T sca2) { Mat<C, R, T> result; if (std::is_constant_evaluated()) for (usize idx = 0; idx < C; ++idx) result[idx] = mat1[idx] + sca2; else simd::Map<C * R>(mat1.data(), result.data(), [sca2](auto lane) { return lane + sca2; }); return result; }
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator-(Mat<C, R, T> const& mat1, T sca2) { Mat<C, R, T> result; if (std::is_constant_evaluated()) for (usize idx = 0; idx < C; ++idx) result[idx] = mat1[idx] - sca2; else simd::Map<C * R>(mat1.data(), result.data(), [sca2](auto lane) { return lane - sca2; }); return result; }
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator*(Mat<C, R, T> const& mat1, T sca2) { Mat<C, R, T> result; if (std::is_constant_evaluated()) for (usize idx = 0; idx < C; ++idx) result[idx] = mat1[idx] * sca2; else simd::Map<C * R>(mat1.data(), result.data(), [sca2](auto lane) { return lane * sca2; }); return result; }
+
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator+(T sca1, Mat<C, R, T> const& mat2) { Mat<C, R, T> result; if (std::is_constant_evaluated()) for (usize idx = 0; idx < C; ++idx) result[idx] = sca1 + mat2[idx]; else simd::Map<C * R>(mat2.data(), result.data(), [sca1](auto lane) { return sca1 + lane; }); return result; }
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator-(T sca1, Mat<C, R, T> const& mat2) { Mat<C, R, T> result; if (std::is_constant_evaluated()) for (usize idx = 0; idx < C; ++idx) result[idx] = sca1 - mat2[idx]; else simd::Map<C * R>(mat2.data(), result.data(), [sca1](auto lane) { return sca1 - lane; }); return result; }
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator*(T sca1, Mat<C, R, T> const& mat2) { Mat<C, R, T> result; if (std::is_constant_evaluated()) for (usize idx = 0; idx < C; ++idx) result[idx] = sca1 * mat2[idx]; else simd::Map<C * R>(mat2.data(), result.data(), [sca1](auto lane) { return sca1 * lane; }); return result; }
+
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator+(Mat<C, R, T> const& mat1, Mat<C, R, T> const& mat2) { Mat<C, R, T> result; if (std::is_constant_evaluated()) for (usize idx = 0; idx < C; ++idx) result[idx] = mat1[idx] + mat2[idx]; else simd::Zip<C * R>(mat1.data(), mat2.data(), result.data(), [](auto lhs, auto rhs) { return lhs + rhs; }); return result; }
+template <usize C, usize R, simd::Portable T> constexpr Mat<C, R, T> operator-(Mat<C, R, T> const& mat1, Mat<C, R, T> const& mat2) { Mat<C, R, T> result; if (std::is_constant_evaluated()) for (usize idx = 0; idx < C; ++idx) result[idx] = mat1[idx] - mat2[idx]; else simd::Zip<C * R>(mat1.data(), mat2.data(), result.data(), [](auto lhs, auto rhs) { return lhs - rhs; }); return result; }
+
+}  // namespace tf
+
+#endif  // TRANSFORM_SIMD_PORTABLE_STDX
+
+#endif  // TRANSFORM_SIMD_MATCXR_H_
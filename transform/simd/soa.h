@@ -0,0 +1,146 @@
+#ifndef TRANSFORM_SIMD_SOA_H_
+#define TRANSFORM_SIMD_SOA_H_
+
+#include "transform/simd/config.h"
+
+#ifdef TRANSFORM_SIMD_SSE
+
+#include <immintrin.h>
+
+#include "transform/types.h"
+
+namespace tf {
+
+namespace simd {
+
+// Conversions between interleaved Vec3/Vec4 storage and one array per component, four vectors per step. `count` must
+// be a multiple of four; `VecSoa::Load` and `VecSoa::Store` copy the rest one by one.
+template <usize L> inline void Deinterleave(f32 const* src, f32* const* dst, usize count) noexcept;
+template <usize L> inline void Interleave  (f32 const* const* src, f32* dst, usize count) noexcept;
+
+// The same step on registers: four packed Vec3 (12 floats) to and from x, y and z lanes.
+inline void Load3 (f32 const* src, __m128& xs, __m128& ys, __m128& zs) noexcept;
+inline void Store3(__m128 xs, __m128 ys, __m128 zs, f32* dst) noexcept;
+
+// dst[idx] = sqrt(src[idx]) over arrays of whole 16-byte registers, aligned to 16 bytes.
+inline void Sqrt(f32 const* src, f32* dst, usize count) noexcept;
+inline void Sqrt(f64 const* src, f64* dst, usize count) noexcept;
+
+/************************
+ * Function definitions *
+ ************************/
+
+inline void Load3(f32 const* src, __m128& xs, __m128& ys, __m128& zs) noexcept {
+  // x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+  __m128 vec0 = _mm_loadu_ps(src + 0);
+  __m128 vec1 = _mm_loadu_ps(src + 4);
+  __m128 vec2 = _mm_loadu_ps(src + 8);
+  __m128 x2y2 = _mm_shuffle_ps(vec1, vec2, _MM_SHUFFLE(2, 1, 3, 2));  // x2 y2 x3 y3
+  __m128 y0z0 = _mm_shuffle_ps(vec0, vec1, _MM_SHUFFLE(1, 0, 2, 1));  // y0 z0 y1 z1
+  xs          = _mm_shuffle_ps(vec0, x2y2, _MM_SHUFFLE(2, 0, 3, 0));
+  ys          = _mm_shuffle_ps(y0z0, x2y2, _MM_SHUFFLE(3, 1, 2, 0));
+  zs          = _mm_shuffle_ps(y0z0, vec2, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+inline void Store3(__m128 xs, __m128 ys, __m128 zs, f32* dst) noexcept {
+  __m128 xy01 = _mm_unpacklo_ps(xs, ys);  // x0 y0 x1 y1
+  __m128 xy23 = _mm_unpackhi_ps(xs, ys);  // x2 y2 x3 y3
+  __m128 z0x1 = _mm_shuffle_ps(zs, xs, _MM_SHUFFLE(1, 1, 0, 0));
+  __m128 y1z1 = _mm_shuffle_ps(ys, zs, _MM_SHUFFLE(1, 1, 1, 1));
+  __m128 z2x3 = _mm_shuffle_ps(zs, xy23, _MM_SHUFFLE(2, 2, 2, 2));
+  __m128 y3z3 = _mm_shuffle_ps(xy23, zs, _MM_SHUFFLE(3, 3, 3, 3));
+  _mm_storeu_ps(dst + 0, _mm_shuffle_ps(xy01, z0x1, _MM_SHUFFLE(2, 0, 1, 0)));
+  _mm_storeu_ps(dst + 4, _mm_shuffle_ps(y1z1, xy23, _MM_SHUFFLE(1, 0, 2, 0)));
+  _mm_storeu_ps(dst + 8, _mm_shuffle_ps(z2x3, y3z3, _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+inline void Sqrt(f32 const* src, f32* dst, usize count) noexcept {
+  usize idx = 0;
+#ifdef TRANSFORM_SIMD_AVX
+  for (; idx + 8 <= count; idx += 8) _mm256_storeu_ps(dst + idx, _mm256_sqrt_ps(_mm256_loadu_ps(src + idx)));
+#endif
+  for (; idx < count; idx += 4) _mm_store_ps(dst + idx, _mm_sqrt_ps(_mm_load_ps(src + idx)));
+}
+inline void Sqrt(f64 const* src, f64* dst, usize count) noexcept {
+  usize idx = 0;
+#ifdef TRANSFORM_SIMD_AVX
+  for (; idx + 4 <= count; idx += 4) _mm256_storeu_pd(dst + idx, _mm256_sqrt_pd(_mm256_loadu_pd(src + idx)));
+#endif
+  for (; idx < count; idx += 2) _mm_store_pd(dst + idx, _mm_sqrt_pd(_mm_load_pd(src + idx)));
+}
+
+template <usize L> inline void Deinterleave(f32 const* src, f32* const* dst, usize count) noexcept {
+  static_assert(L == 3 || L == 4);
+  usize idx = 0;
+#ifdef TRANSFORM_SIMD_AVX
+  // Eight at a time, so that 32-byte reads of the component arrays do not straddle two 16-byte writes.
+  if constexpr (L == 3) {
+    for (; idx + 8 <= count; idx += 8, src += 24) {
+      __m128 xs_lo, ys_lo, zs_lo, xs_hi, ys_hi, zs_hi;
+      Load3(src, xs_lo, ys_lo, zs_lo);
+      Load3(src + 12, xs_hi, ys_hi, zs_hi);
+      _mm256_storeu_ps(dst[0] + idx, _mm256_set_m128(xs_hi, xs_lo));
+      _mm256_storeu_ps(dst[1] + idx, _mm256_set_m128(ys_hi, ys_lo));
+      _mm256_storeu_ps(dst[2] + idx, _mm256_set_m128(zs_hi, zs_lo));
+    }
+  }
+#endif
+  for (; idx < count; idx += 4, src += 4 * L) {
+    if constexpr (L == 3) {
+      __m128 xs, ys, zs;
+      Load3(src, xs, ys, zs);
+      _mm_storeu_ps(dst[0] + idx, xs);
+      _mm_storeu_ps(dst[1] + idx, ys);
+      _mm_storeu_ps(dst[2] + idx, zs);
+    } else {
+      __m128 vec0 = _mm_loadu_ps(src + 0);
+      __m128 vec1 = _mm_loadu_ps(src + 4);
+      __m128 vec2 = _mm_loadu_ps(src + 8);
+      __m128 vec3 = _mm_loadu_ps(src + 12);
+      _MM_TRANSPOSE4_PS(vec0, vec1, vec2, vec3);
+      _mm_storeu_ps(dst[0] + idx, vec0);
+      _mm_storeu_ps(dst[1] + idx, vec1);
+      _mm_storeu_ps(dst[2] + idx, vec2);
+      _mm_storeu_ps(dst[3] + idx, vec3);
+    }
+  }
+}
+
+template <usize L> inline void Interleave(f32 const* const* src, f32* dst, usize count) noexcept {
+  static_assert(L == 3 || L == 4);
+  usize idx = 0;
+#ifdef TRANSFORM_SIMD_AVX
+  if constexpr (L == 3) {
+    for (; idx + 8 <= count; idx += 8, dst += 24) {
+      __m256 xs = _mm256_loadu_ps(src[0] + idx);
+      __m256 ys = _mm256_loadu_ps(src[1] + idx);
+      __m256 zs = _mm256_loadu_ps(src[2] + idx);
+      Store3(_mm256_castps256_ps128(xs), _mm256_castps256_ps128(ys), _mm256_castps256_ps128(zs), dst);
+      Store3(_mm256_extractf128_ps(xs, 1), _mm256_extractf128_ps(ys, 1), _mm256_extractf128_ps(zs, 1), dst + 12);
+    }
+  }
+#endif
+  for (; idx < count; idx += 4, dst += 4 * L) {
+    if constexpr (L == 3) {
+      Store3(_mm_loadu_ps(src[0] + idx), _mm_loadu_ps(src[1] + idx), _mm_loadu_ps(src[2] + idx), dst);
+    } else {
+      __m128 vec0 = _mm_loadu_ps(src[0] + idx);
+      __m128 vec1 = _mm_loadu_ps(src[1] + idx);
+      __m128 vec2 = _mm_loadu_ps(src[2] + idx);
+      __m128 vec3 = _mm_loadu_ps(src[3] + idx);
+      _MM_TRANSPOSE4_PS(vec0, vec1, vec2, vec3);
+      _mm_storeu_ps(dst + 0,  vec0);
+      _mm_storeu_ps(dst + 4,  vec1);
+      _mm_storeu_ps(dst + 8,  vec2);
+      _mm_storeu_ps(dst + 12, vec3);
+    }
+  }
+}
+
+}  // namespace simd
+
+}  // namespace tf
+
+#endif  // TRANSFORM_SIMD_SSE
+
+#endif  // TRANSFORM_SIMD_SOA_H_
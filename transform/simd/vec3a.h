@@ -0,0 +1,172 @@
+#ifndef TRANSFORM_SIMD_VEC3A_H_
+#define TRANSFORM_SIMD_VEC3A_H_
+
+#include "transform/simd/config.h"
+
+#ifdef TRANSFORM_SIMD_SSE
+
+#include <cmath>
+#include <type_traits>
+
+#include <immintrin.h>
+
+#include "transform/types.h"
+#include "transform/mat/matcxr.h"
+#include "transform/simd/mat4.h"
+#include "transform/simd/vec4.h"
+#include "transform/vec/func.h"
+#include "transform/vec/vec3a.h"
+
+namespace tf {
+
+// Non-template overloads for Vec3A<f32>, one __m128 per vector. Like `transform/simd/vec4.h` they fall back to the
+// scalar templates during constant evaluation and compute every lane with the same operations in the same order, so
+// results are bit-identical to the scalar forms (up to FMA contraction, see simd/config.h). Lanes that the scalar
+// forms leave at zero (the w of Cross and Mat4 * Vec3A) are masked back to zero. The compound assignments stay the
+// four-lane loops of `transform/vec/vec3a.h`, which the binary templates are built on and compilers vectorize.
+
+namespace simd {
+
+// `Store` already returns a Vec<4, f32>, so the way back is spelled out.
+inline __m128     Load      (Vec3A<f32> const& vec) noexcept { return _mm_load_ps(vec.data()); }
+inline Vec3A<f32> StoreVec3A(__m128 reg)          noexcept { Vec3A<f32> result; _mm_store_ps(result.data(), reg); return result; }
+
+// All ones in x, y and z, zero in w.
+inline __m128 MaskXyz() noexcept { return _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0)); }
+
+// x * x' + (y * y' + z * z') in lane 0, the fold of the scalar `Dot`; w never enters.
+inline __m128 Dot3(__m128 vec1, __m128 vec2) noexcept;
+
+}  // namespace simd
+
+// --- Unary arithmetic operators ---
+constexpr Vec3A<f32> operator-(Vec3A<f32> const& vec);
+
+// --- Binary arithmetic operators ---
+constexpr Vec3A<f32> operator+(Vec3A<f32> const& vec1, f32 sca2);
+constexpr Vec3A<f32> operator-(Vec3A<f32> const& vec1, f32 sca2);
+constexpr Vec3A<f32> operator*(Vec3A<f32> const& vec1, f32 sca2);
+constexpr Vec3A<f32> operator/(Vec3A<f32> const& vec1, f32 sca2);
+
+constexpr Vec3A<f32> operator+(f32 sca1, Vec3A<f32> const& vec2);
+constexpr Vec3A<f32> operator-(f32 sca1, Vec3A<f32> const& vec2);
+constexpr Vec3A<f32> operator*(f32 sca1, Vec3A<f32> const& vec2);
+constexpr Vec3A<f32> operator/(f32 sca1, Vec3A<f32> const& vec2);
+
+constexpr Vec3A<f32> operator+(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2);
+constexpr Vec3A<f32> operator-(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2);
+constexpr Vec3A<f32> operator*(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2);
+constexpr Vec3A<f32> operator/(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2);
+
+constexpr Vec3A<f32> operator*(Mat<4, 4, f32> const& mat1, Vec3A<f32> const& vec2);
+
+// --- Boolean operators ---
+constexpr bool operator==(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2);
+constexpr bool operator!=(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2);
+
+// --- Functions ---
+constexpr f32        Length   (Vec3A<f32> const& vec);
+constexpr Vec3A<f32> Normalize(Vec3A<f32> const& vec);
+
+constexpr Vec3A<f32> Cross(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2);
+constexpr f32        Dot  (Vec3A<f32> const& vec1, Vec3A<f32> const& vec2);
+
+template <typename P> requires kIsPolicy<P> constexpr f32        Length   (Vec3A<f32> const& vec);
+template <typename P> requires kIsPolicy<P> constexpr Vec3A<f32> Normalize(Vec3A<f32> const& vec);
+
+/************************
+ * Function definitions *
+ ************************/
+
+namespace simd {
+
+inline __m128 Dot3(__m128 vec1, __m128 vec2) noexcept {
+  __m128 mul = _mm_mul_ps(vec1, vec2);
+  __m128 sum = _mm_add_ss(_mm_shuffle_ps(mul, mul, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(mul, mul, _MM_SHUFFLE(2, 2, 2, 2)));
+  return _mm_add_ss(mul, sum);
+}
+
+}  // namespace simd
+
+// --- Unary arithmetic operators ---
+// Flips the sign bit of every lane with one xor, so +0 becomes -0 like the scalar per-lane negation.
+constexpr Vec3A<f32> operator-(Vec3A<f32> const& vec) { if (std::is_constant_evaluated()) return operator-<f32>(vec); return simd::StoreVec3A(_mm_xor_ps(simd::Load(vec), _mm_set1_ps(-0.0F))); }
+
+// --- Binary arithmetic operators ---
+constexpr Vec3A<f32> operator+(Vec3A<f32> const& vec1, f32 sca2) { if (std::is_constant_evaluated()) return operator+<f32>(vec1, sca2); return simd::StoreVec3A(_mm_add_ps(simd::Load(vec1), _mm_set1_ps(sca2))); }
+constexpr Vec3A<f32> operator-(Vec3A<f32> const& vec1, f32 sca2) { if (std::is_constant_evaluated()) return operator-<f32>(vec1, sca2); return simd::StoreVec3A(_mm_sub_ps(simd::Load(vec1), _mm_set1_ps(sca2))); }
+constexpr Vec3A<f32> operator*(Vec3A<f32> const& vec1, f32 sca2) { if (std::is_constant_evaluated()) return operator*<f32>(vec1, sca2); return simd::StoreVec3A(_mm_mul_ps(simd::Load(vec1), _mm_set1_ps(sca2))); }
+constexpr Vec3A<f32> operator/(Vec3A<f32> const& vec1, f32 sca2) { if (std::is_constant_evaluated()) return operator/<f32>(vec1, sca2); return simd::StoreVec3A(_mm_div_ps(simd::Load(vec1), _mm_set1_ps(sca2))); }
+
+// The scalar forms start from Fill(sca1), whose w is zero.
+constexpr Vec3A<f32> operator+(f32 sca1, Vec3A<f32> const& vec2) { if (std::is_constant_evaluated()) return operator+<f32>(sca1, vec2); return simd::StoreVec3A(_mm_add_ps(_mm_setr_ps(sca1, sca1, sca1, 0.0F), simd::Load(vec2))); }
+constexpr Vec3A<f32> operator-(f32 sca1, Vec3A<f32> const& vec2) { if (std::is_constant_evaluated()) return operator-<f32>(sca1, vec2); return simd::StoreVec3A(_mm_sub_ps(_mm_setr_ps(sca1, sca1, sca1, 0.0F), simd::Load(vec2))); }
+constexpr Vec3A<f32> operator*(f32 sca1, Vec3A<f32> const& vec2) { if (std::is_constant_evaluated()) return operator*<f32>(sca1, vec2); return simd::StoreVec3A(_mm_mul_ps(_mm_setr_ps(sca1, sca1, sca1, 0.0F), simd::Load(vec2))); }
+constexpr Vec3A<f32> operator/(f32 sca1, Vec3A<f32> const& vec2) { if (std::is_constant_evaluated()) return operator/<f32>(sca1, vec2); return Vec3A<f32>::Fill(sca1) / vec2; }
+
+constexpr Vec3A<f32> operator+(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2) { if (std::is_constant_evaluated()) return operator+<f32>(vec1, vec2); return simd::StoreVec3A(_mm_add_ps(simd::Load(vec1), simd::Load(vec2))); }
+constexpr Vec3A<f32> operator-(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2) { if (std::is_constant_evaluated()) return operator-<f32>(vec1, vec2); return simd::StoreVec3A(_mm_sub_ps(simd::Load(vec1), simd::Load(vec2))); }
+constexpr Vec3A<f32> operator*(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2) { if (std::is_constant_evaluated()) return operator*<f32>(vec1, vec2); return simd::StoreVec3A(_mm_mul_ps(simd::Load(vec1), simd::Load(vec2))); }
+// The divisor's w is replaced by one, which leaves the dividend's w untouched like the scalar loop over x, y and z.
+constexpr Vec3A<f32> operator/(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2) {
+  if (std::is_constant_evaluated()) return operator/<f32>(vec1, vec2);
+  __m128 mask = simd::MaskXyz();
+  __m128 div  = _mm_or_ps(_mm_and_ps(mask, simd::Load(vec2)), _mm_andnot_ps(mask, _mm_set1_ps(1.0F)));
+  return simd::StoreVec3A(_mm_div_ps(simd::Load(vec1), div));
+}
+
+// `simd::MulColumns` of (x, y, z, 1): the right fold col0 * x + (col1 * y + (col2 * z + col3 * 1)) of the scalar form.
+constexpr Vec3A<f32> operator*(Mat<4, 4, f32> const& mat1, Vec3A<f32> const& vec2) {
+  if (std::is_constant_evaluated()) return operator*<f32>(mat1, vec2);
+  __m128 mask  = simd::MaskXyz();
+  __m128 point = _mm_or_ps(_mm_and_ps(mask, simd::Load(vec2)), _mm_andnot_ps(mask, _mm_set1_ps(1.0F)));
+  return simd::StoreVec3A(_mm_and_ps(simd::MulColumns(mat1.data(), point), mask));
+}
+
+// --- Boolean operators ---
+constexpr bool operator==(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2) { if (std::is_constant_evaluated()) return operator==<f32>(vec1, vec2); return (_mm_movemask_ps(_mm_cmpeq_ps(simd::Load(vec1), simd::Load(vec2))) & 0x7) == 0x7; }
+constexpr bool operator!=(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2) { return !(vec1 == vec2); }
+
+// --- Functions ---
+constexpr f32 Length(Vec3A<f32> const& vec) { return static_cast<f32>(std::sqrt(Dot(vec, vec))); }
+constexpr Vec3A<f32> Normalize(Vec3A<f32> const& vec) {
+  if (std::is_constant_evaluated()) return vec / Length(vec);
+  __m128 reg = simd::Load(vec);
+  return simd::StoreVec3A(_mm_div_ps(reg, _mm_sqrt_ps(_mm_set1_ps(_mm_cvtss_f32(simd::Dot3(reg, reg))))));
+}
+
+// yzx * zxy - zxy * yzx, lane by lane the scalar y1 * z2 - z1 * y2, ...
+constexpr Vec3A<f32> Cross(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2) {
+  if (std::is_constant_evaluated()) return Cross<f32>(vec1, vec2);
+  __m128 reg1 = simd::Load(vec1);
+  __m128 reg2 = simd::Load(vec2);
+  __m128 lhs  = _mm_mul_ps(_mm_shuffle_ps(reg1, reg1, _MM_SHUFFLE(3, 0, 2, 1)), _mm_shuffle_ps(reg2, reg2, _MM_SHUFFLE(3, 1, 0, 2)));
+  __m128 rhs  = _mm_mul_ps(_mm_shuffle_ps(reg1, reg1, _MM_SHUFFLE(3, 1, 0, 2)), _mm_shuffle_ps(reg2, reg2, _MM_SHUFFLE(3, 0, 2, 1)));
+  return simd::StoreVec3A(_mm_and_ps(_mm_sub_ps(lhs, rhs), simd::MaskXyz()));
+}
+constexpr f32 Dot(Vec3A<f32> const& vec1, Vec3A<f32> const& vec2) { if (std::is_constant_evaluated()) return Dot<f32>(vec1, vec2); return _mm_cvtss_f32(simd::Dot3(simd::Load(vec1), simd::Load(vec2))); }
+
+template <typename P> requires kIsPolicy<P> constexpr f32 Length(Vec3A<f32> const& vec) {
+  if constexpr (std::is_same_v<P, Fast>) {
+    if (!std::is_constant_evaluated()) return simd::SqrtFast(Dot(vec, vec));
+  }
+  return Length(vec);
+}
+// The reciprocal square root estimate stays in its register and is broadcast to all four lanes.
+template <typename P> requires kIsPolicy<P> constexpr Vec3A<f32> Normalize(Vec3A<f32> const& vec) {
+  if constexpr (std::is_same_v<P, Fast>) {
+    if (!std::is_constant_evaluated()) {
+      __m128 reg = simd::Load(vec);
+      __m128 inv = simd::InverseSqrtFast(simd::Dot3(reg, reg));
+      return simd::StoreVec3A(_mm_mul_ps(reg, _mm_shuffle_ps(inv, inv, _MM_SHUFFLE(0, 0, 0, 0))));
+    }
+    return vec * (1.0F / Length(vec));
+  }
+  return Normalize(vec);
+}
+
+}  // namespace tf
+
+#endif  // TRANSFORM_SIMD_SSE
+
+#endif  // TRANSFORM_SIMD_VEC3A_H_
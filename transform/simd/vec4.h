@@ -0,0 +1,253 @@
+#ifndef TRANSFORM_SIMD_VEC4_H_
+#define TRANSFORM_SIMD_VEC4_H_
+
+#include "transform/simd/config.h"
+
+#ifdef TRANSFORM_SIMD_SSE
+
+#include <bit>
+#include <cmath>
+#include <type_traits>
+
+#include <immintrin.h>
+
+#include "transform/types.h"
+#include "transform/vec/vec4.h"
+
+namespace tf {
+
+// Non-template overloads for Vec<4, f32>. They win overload resolution against the generic templates in
+// `transform/vec/vec4.h` and `transform/vec/func.h`, keep the lanes in an __m128, and fall back to scalar code during
+// constant evaluation. Every lane is computed with the same operations in the same order as the scalar templates, so
+// results are bit-identical.
+
+namespace simd {
+
+inline __m128      Load (Vec<4, f32> const& vec) noexcept { return _mm_loadu_ps(vec.data()); }
+inline Vec<4, f32> Store(__m128 reg)             noexcept { Vec<4, f32> result; _mm_storeu_ps(result.data(), reg); return result; }
+
+// Vec<4, bool> keeps one byte per lane; these widen it to a full-lane mask and narrow a comparison result back.
+inline __m128       LoadMask (Vec<4, bool> const& mask) noexcept;
+inline Vec<4, bool> StoreMask(__m128 mask)              noexcept;
+
+// The `Fast` precision policy of `transform/vec/func.h`: the 12-bit hardware reciprocal square root estimate refined
+// by one Newton-Raphson step. `SqrtFast` multiplies back and keeps zero at zero.
+inline __m128 InverseSqrtFast(__m128 sca) noexcept;
+inline __m128 SqrtFast       (__m128 sca) noexcept;
+inline f32    InverseSqrtFast(f32    sca) noexcept;
+inline f32    SqrtFast       (f32    sca) noexcept;
+
+// `Normalize<Fast>` keeps the squared length in a register, broadcast by two shuffled adds.
+inline Vec<4, f32> NormalizeFast(Vec<4, f32> const& vec) noexcept;
+
+// Normalizes four vectors per step: their squared lengths are folded in one register after a transpose, in the same
+// order as `Dot`, so the `Exact` policy stays bit-identical to `Normalize`.
+template <bool kFast> inline void NormalizeAll(Vec<4, f32>* vecs, usize count) noexcept;
+
+}  // namespace simd
+
+// --- Unary arithmetic operators ---
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator+=(f32 sca);
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator-=(f32 sca);
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator*=(f32 sca);
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator/=(f32 sca);
+
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator+=(Vec<4, f32> const& vec);
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator-=(Vec<4, f32> const& vec);
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator*=(Vec<4, f32> const& vec);
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator/=(Vec<4, f32> const& vec);
+
+constexpr Vec<4, f32> operator-(Vec<4, f32> const& vec);
+
+// --- Binary arithmetic operators ---
+constexpr Vec<4, f32> operator+(Vec<4, f32> const& vec, f32 sca);
+constexpr Vec<4, f32> operator-(Vec<4, f32> const& vec, f32 sca);
+constexpr Vec<4, f32> operator*(Vec<4, f32> const& vec, f32 sca);
+constexpr Vec<4, f32> operator/(Vec<4, f32> const& vec, f32 sca);
+
+constexpr Vec<4, f32> operator+(f32 sca, Vec<4, f32> const& vec);
+constexpr Vec<4, f32> operator-(f32 sca, Vec<4, f32> const& vec);
+constexpr Vec<4, f32> operator*(f32 sca, Vec<4, f32> const& vec);
+constexpr Vec<4, f32> operator/(f32 sca, Vec<4, f32> const& vec);
+
+constexpr Vec<4, f32> operator+(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2);
+constexpr Vec<4, f32> operator-(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2);
+constexpr Vec<4, f32> operator*(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2);
+constexpr Vec<4, f32> operator/(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2);
+
+// --- Boolean operators ---
+constexpr bool operator==(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2);
+constexpr bool operator!=(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2);
+
+// --- Comparison operators ---
+constexpr Vec<4, bool> operator< (Vec<4, f32> const& vec1, Vec<4, f32> const& vec2);
+constexpr Vec<4, bool> operator<=(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2);
+constexpr Vec<4, bool> operator> (Vec<4, f32> const& vec1, Vec<4, f32> const& vec2);
+constexpr Vec<4, bool> operator>=(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2);
+
+constexpr Vec<4, bool> operator< (Vec<4, f32> const& vec, f32 sca);
+constexpr Vec<4, bool> operator<=(Vec<4, f32> const& vec, f32 sca);
+constexpr Vec<4, bool> operator> (Vec<4, f32> const& vec, f32 sca);
+constexpr Vec<4, bool> operator>=(Vec<4, f32> const& vec, f32 sca);
+
+// --- Lane masks ---
+constexpr Vec<4, bool> Equal   (Vec<4, f32> const& vec1, Vec<4, f32> const& vec2);
+constexpr Vec<4, bool> NotEqual(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2);
+constexpr Vec<4, f32>  Select  (Vec<4, bool> const& mask, Vec<4, f32> const& vec1, Vec<4, f32> const& vec2);
+
+// --- Functions ---
+constexpr f32         Dot      (Vec<4, f32> const& vec1, Vec<4, f32> const& vec2);
+constexpr f32         Length   (Vec<4, f32> const& vec);
+constexpr Vec<4, f32> Normalize(Vec<4, f32> const& vec);
+
+/************************
+ * Function definitions *
+ ************************/
+
+namespace simd {
+
+// Bytes 0/1 are duplicated up to 32-bit lanes (0 or 0x01010101) and compared against zero.
+inline __m128 LoadMask(Vec<4, bool> const& mask) noexcept {
+  __m128i lanes = _mm_cvtsi32_si128(std::bit_cast<i32>(mask));
+  lanes         = _mm_unpacklo_epi8(lanes, lanes);
+  lanes         = _mm_unpacklo_epi16(lanes, lanes);
+  return _mm_castsi128_ps(_mm_cmpgt_epi32(lanes, _mm_setzero_si128()));
+}
+// All-ones lanes saturate to 0xFF bytes through the two packs; the low bit of each is the bool.
+inline Vec<4, bool> StoreMask(__m128 mask) noexcept {
+  __m128i lanes = _mm_castps_si128(mask);
+  lanes         = _mm_packs_epi32(lanes, lanes);
+  lanes         = _mm_packs_epi16(lanes, lanes);
+  return std::bit_cast<Vec<4, bool>>(_mm_cvtsi128_si32(_mm_and_si128(lanes, _mm_set1_epi8(1))));
+}
+
+inline __m128 InverseSqrtFast(__m128 sca) noexcept {
+  __m128 est  = _mm_rsqrt_ps(sca);
+  __m128 half = _mm_mul_ps(_mm_set1_ps(0.5F), sca);
+  return _mm_mul_ps(est, _mm_sub_ps(_mm_set1_ps(1.5F), _mm_mul_ps(half, _mm_mul_ps(est, est))));
+}
+inline __m128 SqrtFast(__m128 sca) noexcept { return _mm_and_ps(_mm_mul_ps(sca, InverseSqrtFast(sca)), _mm_cmpneq_ps(sca, _mm_setzero_ps())); }
+inline f32    InverseSqrtFast(f32 sca) noexcept { return _mm_cvtss_f32(InverseSqrtFast(_mm_set_ss(sca))); }
+inline f32    SqrtFast       (f32 sca) noexcept { return _mm_cvtss_f32(SqrtFast(_mm_set_ss(sca))); }
+
+inline Vec<4, f32> NormalizeFast(Vec<4, f32> const& vec) noexcept {
+  __m128 reg = Load(vec);
+  __m128 dot = _mm_mul_ps(reg, reg);
+  dot        = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(2, 3, 0, 1)));
+  dot        = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(1, 0, 3, 2)));
+  return Store(_mm_mul_ps(reg, InverseSqrtFast(dot)));
+}
+
+template <bool kFast> inline void NormalizeAll(Vec<4, f32>* vecs, usize count) noexcept {
+  usize idx = 0;
+  for (; idx + 4 <= count; idx += 4) {
+    __m128 vec0 = Load(vecs[idx + 0]);
+    __m128 vec1 = Load(vecs[idx + 1]);
+    __m128 vec2 = Load(vecs[idx + 2]);
+    __m128 vec3 = Load(vecs[idx + 3]);
+    __m128 xs = vec0, ys = vec1, zs = vec2, ws = vec3;
+    _MM_TRANSPOSE4_PS(xs, ys, zs, ws);
+    __m128 dot = _mm_add_ps(_mm_mul_ps(zs, zs), _mm_mul_ps(ws, ws));
+    dot        = _mm_add_ps(_mm_mul_ps(ys, ys), dot);
+    dot        = _mm_add_ps(_mm_mul_ps(xs, xs), dot);
+    if constexpr (kFast) {
+      __m128 inv = InverseSqrtFast(dot);
+      vec0       = _mm_mul_ps(vec0, _mm_shuffle_ps(inv, inv, _MM_SHUFFLE(0, 0, 0, 0)));
+      vec1       = _mm_mul_ps(vec1, _mm_shuffle_ps(inv, inv, _MM_SHUFFLE(1, 1, 1, 1)));
+      vec2       = _mm_mul_ps(vec2, _mm_shuffle_ps(inv, inv, _MM_SHUFFLE(2, 2, 2, 2)));
+      vec3       = _mm_mul_ps(vec3, _mm_shuffle_ps(inv, inv, _MM_SHUFFLE(3, 3, 3, 3)));
+    } else {
+      __m128 len = _mm_sqrt_ps(dot);
+      vec0       = _mm_div_ps(vec0, _mm_shuffle_ps(len, len, _MM_SHUFFLE(0, 0, 0, 0)));
+      vec1       = _mm_div_ps(vec1, _mm_shuffle_ps(len, len, _MM_SHUFFLE(1, 1, 1, 1)));
+      vec2       = _mm_div_ps(vec2, _mm_shuffle_ps(len, len, _MM_SHUFFLE(2, 2, 2, 2)));
+      vec3       = _mm_div_ps(vec3, _mm_shuffle_ps(len, len, _MM_SHUFFLE(3, 3, 3, 3)));
+    }
+    _mm_storeu_ps(vecs[idx + 0].data(), vec0);
+    _mm_storeu_ps(vecs[idx + 1].data(), vec1);
+    _mm_storeu_ps(vecs[idx + 2].data(), vec2);
+    _mm_storeu_ps(vecs[idx + 3].data(), vec3);
+  }
+  for (; idx < count; ++idx) {
+    if constexpr (kFast) vecs[idx] = NormalizeFast(vecs[idx]);
+    else _mm_storeu_ps(vecs[idx].data(), _mm_div_ps(Load(vecs[idx]), _mm_sqrt_ps(_mm_set1_ps(Dot(vecs[idx], vecs[idx])))));
+  }
+}
+
+}  // namespace simd
+
+// --- Unary arithmetic operators ---
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator+=(f32 sca) { return *this = *this + sca; }
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator-=(f32 sca) { return *this = *this - sca; }
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator*=(f32 sca) { return *this = *this * sca; }
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator/=(f32 sca) { return *this = *this / sca; }
+
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator+=(Vec<4, f32> const& vec) { return *this = *this + vec; }
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator-=(Vec<4, f32> const& vec) { return *this = *this - vec; }
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator*=(Vec<4, f32> const& vec) { return *this = *this * vec; }
+template <> template <> constexpr Vec<4, f32>& Vec<4, f32>::operator/=(Vec<4, f32> const& vec) { return *this = *this / vec; }
+
+constexpr Vec<4, f32> operator-(Vec<4, f32> const& vec) { if (std::is_constant_evaluated()) return operator-<f32>(vec); return simd::Store(_mm_xor_ps(simd::Load(vec), _mm_set1_ps(-0.0F))); }
+
+// --- Binary arithmetic operators ---
+constexpr Vec<4, f32> operator+(Vec<4, f32> const& vec, f32 sca) { if (std::is_constant_evaluated()) return operator+<f32>(vec, sca); return simd::Store(_mm_add_ps(simd::Load(vec), _mm_set1_ps(sca))); }
+constexpr Vec<4, f32> operator-(Vec<4, f32> const& vec, f32 sca) { if (std::is_constant_evaluated()) return operator-<f32>(vec, sca); return simd::Store(_mm_sub_ps(simd::Load(vec), _mm_set1_ps(sca))); }
+constexpr Vec<4, f32> operator*(Vec<4, f32> const& vec, f32 sca) { if (std::is_constant_evaluated()) return operator*<f32>(vec, sca); return simd::Store(_mm_mul_ps(simd::Load(vec), _mm_set1_ps(sca))); }
+constexpr Vec<4, f32> operator/(Vec<4, f32> const& vec, f32 sca) { if (std::is_constant_evaluated()) return operator/<f32>(vec, sca); return simd::Store(_mm_div_ps(simd::Load(vec), _mm_set1_ps(sca))); }
+
+constexpr Vec<4, f32> operator+(f32 sca, Vec<4, f32> const& vec) { if (std::is_constant_evaluated()) return operator+<f32>(sca, vec); return simd::Store(_mm_add_ps(_mm_set1_ps(sca), simd::Load(vec))); }
+constexpr Vec<4, f32> operator-(f32 sca, Vec<4, f32> const& vec) { if (std::is_constant_evaluated()) return operator-<f32>(sca, vec); return simd::Store(_mm_sub_ps(_mm_set1_ps(sca), simd::Load(vec))); }
+constexpr Vec<4, f32> operator*(f32 sca, Vec<4, f32> const& vec) { if (std::is_constant_evaluated()) return operator*<f32>(sca, vec); return simd::Store(_mm_mul_ps(_mm_set1_ps(sca), simd::Load(vec))); }
+constexpr Vec<4, f32> operator/(f32 sca, Vec<4, f32> const& vec) { if (std::is_constant_evaluated()) return operator/<f32>(sca, vec); return simd::Store(_mm_div_ps(_mm_set1_ps(sca), simd::Load(vec))); }
+
+constexpr Vec<4, f32> operator+(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2) { if (std::is_constant_evaluated()) return operator+<f32>(vec1, vec2); return simd::Store(_mm_add_ps(simd::Load(vec1), simd::Load(vec2))); }
+constexpr Vec<4, f32> operator-(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2) { if (std::is_constant_evaluated()) return operator-<f32>(vec1, vec2); return simd::Store(_mm_sub_ps(simd::Load(vec1), simd::Load(vec2))); }
+constexpr Vec<4, f32> operator*(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2) { if (std::is_constant_evaluated()) return operator*<f32>(vec1, vec2); return simd::Store(_mm_mul_ps(simd::Load(vec1), simd::Load(vec2))); }
+constexpr Vec<4, f32> operator/(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2) { if (std::is_constant_evaluated()) return operator/<f32>(vec1, vec2); return simd::Store(_mm_div_ps(simd::Load(vec1), simd::Load(vec2))); }
+
+// --- Boolean operators ---
+constexpr bool operator==(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2) { if (std::is_constant_evaluated()) return operator==<f32>(vec1, vec2); return _mm_movemask_ps(_mm_cmpeq_ps(simd::Load(vec1), simd::Load(vec2))) == 0xF; }
+constexpr bool operator!=(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2) { return !(vec1 == vec2); }
+
+// --- Comparison operators ---
+constexpr Vec<4, bool> operator< (Vec<4, f32> const& vec1, Vec<4, f32> const& vec2) { if (std::is_constant_evaluated()) return operator< <f32>(vec1, vec2); return simd::StoreMask(_mm_cmplt_ps(simd::Load(vec1), simd::Load(vec2))); }
+constexpr Vec<4, bool> operator<=(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2) { if (std::is_constant_evaluated()) return operator<=<f32>(vec1, vec2); return simd::StoreMask(_mm_cmple_ps(simd::Load(vec1), simd::Load(vec2))); }
+constexpr Vec<4, bool> operator> (Vec<4, f32> const& vec1, Vec<4, f32> const& vec2) { if (std::is_constant_evaluated()) return operator> <f32>(vec1, vec2); return simd::StoreMask(_mm_cmpgt_ps(simd::Load(vec1), simd::Load(vec2))); }
+constexpr Vec<4, bool> operator>=(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2) { if (std::is_constant_evaluated()) return operator>=<f32>(vec1, vec2); return simd::StoreMask(_mm_cmpge_ps(simd::Load(vec1), simd::Load(vec2))); }
+
+constexpr Vec<4, bool> operator< (Vec<4, f32> const& vec, f32 sca) { if (std::is_constant_evaluated()) return operator< <f32>(vec, sca); return simd::StoreMask(_mm_cmplt_ps(simd::Load(vec), _mm_set1_ps(sca))); }
+constexpr Vec<4, bool> operator<=(Vec<4, f32> const& vec, f32 sca) { if (std::is_constant_evaluated()) return operator<=<f32>(vec, sca); return simd::StoreMask(_mm_cmple_ps(simd::Load(vec), _mm_set1_ps(sca))); }
+constexpr Vec<4, bool> operator> (Vec<4, f32> const& vec, f32 sca) { if (std::is_constant_evaluated()) return operator> <f32>(vec, sca); return simd::StoreMask(_mm_cmpgt_ps(simd::Load(vec), _mm_set1_ps(sca))); }
+constexpr Vec<4, bool> operator>=(Vec<4, f32> const& vec, f32 sca) { if (std::is_constant_evaluated()) return operator>=<f32>(vec, sca); return simd::StoreMask(_mm_cmpge_ps(simd::Load(vec), _mm_set1_ps(sca))); }
+
+// --- Lane masks ---
+// The generic templates live in `transform/vec/func.h`, which includes this header, so constant evaluation spells them out.
+constexpr Vec<4, bool> Equal   (Vec<4, f32> const& vec1, Vec<4, f32> const& vec2) { if (std::is_constant_evaluated()) return Vec<4, bool>(vec1[0] == vec2[0], vec1[1] == vec2[1], vec1[2] == vec2[2], vec1[3] == vec2[3]); return simd::StoreMask(_mm_cmpeq_ps (simd::Load(vec1), simd::Load(vec2))); }
+constexpr Vec<4, bool> NotEqual(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2) { if (std::is_constant_evaluated()) return Vec<4, bool>(vec1[0] != vec2[0], vec1[1] != vec2[1], vec1[2] != vec2[2], vec1[3] != vec2[3]); return simd::StoreMask(_mm_cmpneq_ps(simd::Load(vec1), simd::Load(vec2))); }
+constexpr Vec<4, f32>  Select  (Vec<4, bool> const& mask, Vec<4, f32> const& vec1, Vec<4, f32> const& vec2) {
+  if (std::is_constant_evaluated()) return Vec<4, f32>(mask[0] ? vec1[0] : vec2[0], mask[1] ? vec1[1] : vec2[1], mask[2] ? vec1[2] : vec2[2], mask[3] ? vec1[3] : vec2[3]);
+  __m128 lanes = simd::LoadMask(mask);
+  return simd::Store(_mm_or_ps(_mm_and_ps(lanes, simd::Load(vec1)), _mm_andnot_ps(lanes, simd::Load(vec2))));
+}
+
+// --- Functions ---
+// `Sum` folds from the right, x + (y + (z + w)), and the shuffles below keep that order.
+constexpr f32 Dot(Vec<4, f32> const& vec1, Vec<4, f32> const& vec2) {
+  if (std::is_constant_evaluated()) return vec1[0] * vec2[0] + (vec1[1] * vec2[1] + (vec1[2] * vec2[2] + vec1[3] * vec2[3]));
+  __m128 mul = _mm_mul_ps(simd::Load(vec1), simd::Load(vec2));
+  __m128 sum = _mm_add_ss(_mm_shuffle_ps(mul, mul, _MM_SHUFFLE(2, 2, 2, 2)), _mm_shuffle_ps(mul, mul, _MM_SHUFFLE(3, 3, 3, 3)));
+  sum        = _mm_add_ss(_mm_shuffle_ps(mul, mul, _MM_SHUFFLE(1, 1, 1, 1)), sum);
+  return _mm_cvtss_f32(_mm_add_ss(mul, sum));
+}
+constexpr f32         Length   (Vec<4, f32> const& vec) { return static_cast<f32>(std::sqrt(Dot(vec, vec))); }
+constexpr Vec<4, f32> Normalize(Vec<4, f32> const& vec) {
+  if (std::is_constant_evaluated()) return vec / Length(vec);
+  __m128 reg = simd::Load(vec);
+  return simd::Store(_mm_div_ps(reg, _mm_sqrt_ps(_mm_set1_ps(Dot(vec, vec)))));
+}
+
+}  // namespace tf
+
+#endif  // TRANSFORM_SIMD_SSE
+
+#endif  // TRANSFORM_SIMD_VEC4_H_
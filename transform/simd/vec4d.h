@@ -0,0 +1,125 @@
+#ifndef TRANSFORM_SIMD_VEC4D_H_
+#define TRANSFORM_SIMD_VEC4D_H_
+
+#include "transform/simd/config.h"
+
+#ifdef TRANSFORM_SIMD_AVX
+
+#include <cmath>
+#include <type_traits>
+
+#include <immintrin.h>
+
+#include "transform/types.h"
+#include "transform/vec/vec4.h"
+
+namespace tf {
+
+// The Vec<4, f64> counterpart of `transform/simd/vec4.h`: the same overloads on an __m256d, bit-identical to the scalar
+// templates.
+
+namespace simd {
+
+inline __m256d     Load (Vec<4, f64> const& vec) noexcept { return _mm256_loadu_pd(vec.data()); }
+inline Vec<4, f64> Store(__m256d reg)            noexcept { Vec<4, f64> result; _mm256_storeu_pd(result.data(), reg); return result; }
+
+}  // namespace simd
+
+// --- Unary arithmetic operators ---
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator+=(f64 sca);
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator-=(f64 sca);
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator*=(f64 sca);
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator/=(f64 sca);
+
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator+=(Vec<4, f64> const& vec);
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator-=(Vec<4, f64> const& vec);
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator*=(Vec<4, f64> const& vec);
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator/=(Vec<4, f64> const& vec);
+
+constexpr Vec<4, f64> operator-(Vec<4, f64> const& vec);
+
+// --- Binary arithmetic operators ---
+constexpr Vec<4, f64> operator+(Vec<4, f64> const& vec, f64 sca);
+constexpr Vec<4, f64> operator-(Vec<4, f64> const& vec, f64 sca);
+constexpr Vec<4, f64> operator*(Vec<4, f64> const& vec, f64 sca);
+constexpr Vec<4, f64> operator/(Vec<4, f64> const& vec, f64 sca);
+
+constexpr Vec<4, f64> operator+(f64 sca, Vec<4, f64> const& vec);
+constexpr Vec<4, f64> operator-(f64 sca, Vec<4, f64> const& vec);
+constexpr Vec<4, f64> operator*(f64 sca, Vec<4, f64> const& vec);
+constexpr Vec<4, f64> operator/(f64 sca, Vec<4, f64> const& vec);
+
+constexpr Vec<4, f64> operator+(Vec<4, f64> const& vec1, Vec<4, f64> const& vec2);
+constexpr Vec<4, f64> operator-(Vec<4, f64> const& vec1, Vec<4, f64> const& vec2);
+constexpr Vec<4, f64> operator*(Vec<4, f64> const& vec1, Vec<4, f64> const& vec2);
+constexpr Vec<4, f64> operator/(Vec<4, f64> const& vec1, Vec<4, f64> const& vec2);
+
+// --- Boolean operators ---
+constexpr bool operator==(Vec<4, f64> const& vec1, Vec<4, f64> const& vec2);
+constexpr bool operator!=(Vec<4, f64> const& vec1, Vec<4, f64> const& vec2);
+
+// --- Functions ---
+constexpr f64         Dot      (Vec<4, f64> const& vec1, Vec<4, f64> const& vec2);
+constexpr f64         Length   (Vec<4, f64> const& vec);
+constexpr Vec<4, f64> Normalize(Vec<4, f64> const& vec);
+
+/************************
+ * Function definitions *
+ ************************/
+
+// --- Unary arithmetic operators ---
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator+=(f64 sca) { return *this = *this + sca; }
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator-=(f64 sca) { return *this = *this - sca; }
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator*=(f64 sca) { return *this = *this * sca; }
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator/=(f64 sca) { return *this = *this / sca; }
+
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator+=(Vec<4, f64> const& vec) { return *this = *this + vec; }
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator-=(Vec<4, f64> const& vec) { return *this = *this - vec; }
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator*=(Vec<4, f64> const& vec) { return *this = *this * vec; }
+template <> template <> constexpr Vec<4, f64>& Vec<4, f64>::operator/=(Vec<4, f64> const& vec) { return *this = *this / vec; }
+
+constexpr Vec<4, f64> operator-(Vec<4, f64> const& vec) { if (std::is_constant_evaluated()) return operator-<f64>(vec); return simd::Store(_mm256_xor_pd(simd::Load(vec), _mm256_set1_pd(-0.0))); }
+
+// --- Binary arithmetic operators ---
+constexpr Vec<4, f64> operator+(Vec<4, f64> const& vec, f64 sca) { if (std::is_constant_evaluated()) return operator+<f64>(vec, sca); return simd::Store(_mm256_add_pd(simd::Load(vec), _mm256_set1_pd(sca))); }
+constexpr Vec<4, f64> operator-(Vec<4, f64> const& vec, f64 sca) { if (std::is_constant_evaluated()) return operator-<f64>(vec, sca); return simd::Store(_mm256_sub_pd(simd::Load(vec), _mm256_set1_pd(sca))); }
+constexpr Vec<4, f64> operator*(Vec<4, f64> const& vec, f64 sca) { if (std::is_constant_evaluated()) return operator*<f64>(vec, sca); return simd::Store(_mm256_mul_pd(simd::Load(vec), _mm256_set1_pd(sca))); }
+constexpr Vec<4, f64> operator/(Vec<4, f64> const& vec, f64 sca) { if (std::is_constant_evaluated()) return operator/<f64>(vec, sca); return simd::Store(_mm256_div_pd(simd::Load(vec), _mm256_set1_pd(sca))); }
+
+constexpr Vec<4, f64> operator+(f64 sca, Vec<4, f64> const& vec) { if (std::is_constant_evaluated()) return operator+<f64>(sca, vec); return simd::Store(_mm256_add_pd(_mm256_set1_pd(sca), simd::Load(vec))); }
+constexpr Vec<4, f64> operator-(f64 sca, Vec<4, f64> const& vec) { if (std::is_constant_evaluated()) return operator-<f64>(sca, vec); return simd::Store(_mm256_sub_pd(_mm256_set1_pd(sca), simd::Load(vec))); }
+constexpr Vec<4, f64> operator*(f64 sca, Vec<4, f64> const& vec) { if (std::is_constant_evaluated()) return operator*<f64>(sca, vec); return simd::Store(_mm256_mul_pd(_mm256_set1_pd(sca), simd::Load(vec))); }
+constexpr Vec<4, f64> operator/(f64 sca, Vec<4, f64> const& vec) { if (std::is_constant_evaluated()) return operator/<f64>(sca, vec); return simd::Store(_mm256_div_pd(_mm256_set1_pd(sca), simd::Load(vec))); }
+
+constexpr Vec<4, f64> operator+(Vec<4, f64> const& vec1, Vec<4, f64> const& vec2) { if (std::is_constant_evaluated()) return operator+<f64>(vec1, vec2); return simd::Store(_mm256_add_pd(simd::Load(vec1), simd::Load(vec2))); }
+constexpr Vec<4, f64> operator-(Vec<4, f64> const& vec1, Vec<4, f64> const& vec2) { if (std::is_constant_evaluated()) return operator-<f64>(vec1, vec2); return simd::Store(_mm256_sub_pd(simd::Load(vec1), simd::Load(vec2))); }
+constexpr Vec<4, f64> operator*(Vec<4, f64> const& vec1, Vec<4, f64> const& vec2) { if (std::is_constant_evaluated()) return operator*<f64>(vec1, vec2); return simd::Store(_mm256_mul_pd(simd::Load(vec1), simd::Load(vec2))); }
+constexpr Vec<4, f64> operator/(Vec<4, f64> const& vec1, Vec<4, f64> const& vec2) { if (std::is_constant_evaluated()) return operator/<f64>(vec1, vec2); return simd::Store(_mm256_div_pd(simd::Load(vec1), simd::Load(vec2))); }
+
+// --- Boolean operators ---
+constexpr bool operator==(Vec<4, f64> const& vec1, Vec<4, f64> const& vec2) { if (std::is_constant_evaluated()) return operator==<f64>(vec1, vec2); return _mm256_movemask_pd(_mm256_cmp_pd(simd::Load(vec1), simd::Load(vec2), _CMP_EQ_OQ)) == 0xF; }
+constexpr bool operator!=(Vec<4, f64> const& vec1, Vec<4, f64> const& vec2) { return !(vec1 == vec2); }
+
+// --- Functions ---
+// `Sum` folds from the right, x + (y + (z + w)), and the extracts below keep that order.
+constexpr f64 Dot(Vec<4, f64> const& vec1, Vec<4, f64> const& vec2) {
+  if (std::is_constant_evaluated()) return vec1[0] * vec2[0] + (vec1[1] * vec2[1] + (vec1[2] * vec2[2] + vec1[3] * vec2[3]));
+  __m256d mul = _mm256_mul_pd(simd::Load(vec1), simd::Load(vec2));
+  __m128d low = _mm256_castpd256_pd128(mul);
+  __m128d upp = _mm256_extractf128_pd(mul, 1);
+  __m128d sum = _mm_add_sd(upp, _mm_unpackhi_pd(upp, upp));
+  sum         = _mm_add_sd(_mm_unpackhi_pd(low, low), sum);
+  return _mm_cvtsd_f64(_mm_add_sd(low, sum));
+}
+constexpr f64         Length   (Vec<4, f64> const& vec) { return static_cast<f64>(std::sqrt(Dot(vec, vec))); }
+constexpr Vec<4, f64> Normalize(Vec<4, f64> const& vec) {
+  if (std::is_constant_evaluated()) return vec / Length(vec);
+  __m256d reg = simd::Load(vec);
+  return simd::Store(_mm256_div_pd(reg, _mm256_sqrt_pd(_mm256_set1_pd(Dot(vec, vec)))));
+}
+
+}  // namespace tf
+
+#endif  // TRANSFORM_SIMD_AVX
+
+#endif  // TRANSFORM_SIMD_VEC4D_H_
@@ -0,0 +1,128 @@
+#ifndef TRANSFORM_SIMD_VECN_H_
+#define TRANSFORM_SIMD_VECN_H_
+
+#include "transform/simd/config.h"
+
+#ifdef TRANSFORM_SIMD_PORTABLE_STDX
+
+#include <algorithm>
+#include <type_traits>
+
+// GCC 12 warns about uninitialized registers inside its own AVX-512 intrinsics when integer simd division is
+// instantiated for an AVX-512 target.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 13
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <experimental/simd>
+#pragma GCC diagnostic pop
+#else
+#include <experimental/simd>
+#endif
+
+#include "transform/types.h"
+#include "transform/vec/vecn.h"
+
+namespace tf {
+
+// Portable overloads for the arithmetic operators of `transform/vec/vecn.h` (unary -, and + - * / with a scalar or a
+// Vec on either side), written on `std::experimental::simd` so they follow whatever instruction set the compiler
+// targets. They carry the same signatures as the generic templates plus a constraint, so they win for every Vec<L, T>
+// the generic templates serve and never compete with the Vec1-4 specializations. Each lane is computed with the same
+// single operation as the scalar loop, so results are bit-identical; constant evaluation keeps the scalar loop.
+// The compound assignments, %, and the bitwise and shift operators are not covered and stay the generic loops.
+
+namespace simd {
+
+namespace stdx = std::experimental;
+
+// Element types `std::experimental::simd` can hold.
+template <typename T> concept Portable = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+template <usize N, typename T> using Pack = stdx::fixed_size_simd<T, N>;
+
+// Widest pack used for N elements. Longer arrays are processed in chunks with one narrower pack for the tail.
+template <usize N, typename T> inline constexpr usize kPackWidth = std::min<usize>(N, stdx::simd_abi::max_fixed_size<T>);
+
+// Applies `op` to N elements, a whole pack at a time at run time and lane by lane during constant evaluation. `op`
+// receives either packs or scalars, so a single generic lambda describes both paths.
+template <usize N, typename T, typename Op> constexpr void Map(T const* src, T* dst, Op op);
+template <usize N, typename T, typename Op> constexpr void Zip(T const* lhs, T const* rhs, T* dst, Op op);
+
+}  // namespace simd
+
+// --- Unary arithmetic operators ---
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator-(Vec<L, T> const& vec);
+
+// --- Binary arithmetic operators ---
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator+(Vec<L, T> const& vec, T sca);
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator-(Vec<L, T> const& vec, T sca);
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator*(Vec<L, T> const& vec, T sca);
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator/(Vec<L, T> const& vec, T sca);
+
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator+(T sca, Vec<L, T> const& vec);
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator-(T sca, Vec<L, T> const& vec);
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator*(T sca, Vec<L, T> const& vec);
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator/(T sca, Vec<L, T> const& vec);
+
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator+(Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator-(Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator*(Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator/(Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+
+/************************
+ * Function definitions *
+ ************************/
+
+namespace simd {
+
+template <usize N, typename T, typename Op> constexpr void Map(T const* src, T* dst, Op op) {
+  if (std::is_constant_evaluated()) {
+    for (usize idx = 0; idx < N; ++idx) dst[idx] = static_cast<T>(op(src[idx]));
+    return;
+  }
+  constexpr usize kWidth = kPackWidth<N, T>;
+  constexpr usize kTail  = N % kWidth;
+  usize idx = 0;
+  for (; idx + kWidth <= N; idx += kWidth) op(Pack<kWidth, T>(src + idx, stdx::element_aligned)).copy_to(dst + idx, stdx::element_aligned);
+  if constexpr (kTail != 0) op(Pack<kTail, T>(src + idx, stdx::element_aligned)).copy_to(dst + idx, stdx::element_aligned);
+}
+
+template <usize N, typename T, typename Op> constexpr void Zip(T const* lhs, T const* rhs, T* dst, Op op) {
+  if (std::is_constant_evaluated()) {
+    for (usize idx = 0; idx < N; ++idx) dst[idx] = static_cast<T>(op(lhs[idx], rhs[idx]));
+    return;
+  }
+  constexpr usize kWidth = kPackWidth<N, T>;
+  constexpr usize kTail  = N % kWidth;
+  usize idx = 0;
+  for (; idx + kWidth <= N; idx += kWidth) op(Pack<kWidth, T>(lhs + idx, stdx::element_aligned), Pack<kWidth, T>(rhs + idx, stdx::element_aligned)).copy_to(dst + idx, stdx::element_aligned);
+  if constexpr (kTail != 0) op(Pack<kTail, T>(lhs + idx, stdx::element_aligned), Pack<kTail, T>(rhs + idx, stdx::element_aligned)).copy_to(dst + idx, stdx::element_aligned);
+}
+
+}  // namespace simd
+
+// --- Unary arithmetic operators ---
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator-(Vec<L, T> const& vec) { Vec<L, T> result; simd::Map<L>(vec.data(), result.data(), [](auto lane) { return -lane; }); return result; }
+
+// --- Binary arithmetic operators ---
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator+(Vec<L, T> const& vec, T sca) { Vec<L, T> result; simd::Map<L>(vec.data(), result.data(), [sca](auto lane) { return lane + sca; }); return result; }
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator-(Vec<L, T> const& vec, T sca) { Vec<L, T> result; simd::Map<L>(vec.data(), result.data(), [sca](auto lane) { return lane - sca; }); return result; }
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator*(Vec<L, T> const& vec, T sca) { Vec<L, T> result; simd::Map<L>(vec.data(), result.data(), [sca](auto lane) { return lane * sca; }); return result; }
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator/(Vec<L, T> const& vec, T sca) { Vec<L, T> result; simd::Map<L>(vec.data(), result.data(), [sca](auto lane) { return lane / sca; }); return result; }
+
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator+(T sca, Vec<L, T> const& vec) { Vec<L, T> result; simd::Map<L>(vec.data(), result.data(), [sca](auto lane) { return sca + lane; }); return result; }
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator-(T sca, Vec<L, T> const& vec) { Vec<L, T> result; simd::Map<L>(vec.data(), result.data(), [sca](auto lane) { return sca - lane; }); return result; }
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator*(T sca, Vec<L, T> const& vec) { Vec<L, T> result; simd::Map<L>(vec.data(), result.data(), [sca](auto lane) { return sca * lane; }); return result; }
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator/(T sca, Vec<L, T> const& vec) { Vec<L, T> result; simd::Map<L>(vec.data(), result.data(), [sca](auto lane) { return sca / lane; }); return result; }
+
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator+(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; simd::Zip<L>(vec1.data(), vec2.data(), result.data(), [](auto lhs, auto rhs) { return lhs + rhs; }); return result; }
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator-(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; simd::Zip<L>(vec1.data(), vec2.data(), result.data(), [](auto lhs, auto rhs) { return lhs - rhs; }); return result; }
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator*(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; simd::Zip<L>(vec1.data(), vec2.data(), result.data(), [](auto lhs, auto rhs) { return lhs * rhs; }); return result; }
+template <usize L, simd::Portable T> constexpr Vec<L, T> operator/(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; simd::Zip<L>(vec1.data(), vec2.data(), result.data(), [](auto lhs, auto rhs) { return lhs / rhs; }); return result; }
+
+}  // namespace tf
+
+#endif  // TRANSFORM_SIMD_PORTABLE_STDX
+
+#endif  // TRANSFORM_SIMD_VECN_H_
@@ -1,13 +1,25 @@
 #ifndef TRANSFORM_TRANSFORM_BASIC_H_
 #define TRANSFORM_TRANSFORM_BASIC_H_
 
+#include <cassert>
 #include <cmath>
+#include <ranges>
+#include <span>
+#include <type_traits>
 
+#include "transform/mat/func.h"
 #include "transform/mat/matcxr.h"
 #include "transform/vec/func.h"
 
 namespace tf {
 
+namespace detail {
+// The span overloads of `MultiplyAll` and the batched `NormalMatrix` wrap T in `std::type_identity_t`, so each also has
+// a forwarding overload that deduces T from the element type of the output, and arrays, spans and std::vector all work
+// alike.
+template <typename R> using RangeValueType = typename std::ranges::range_value_t<R>::ValueType;
+}  // namespace detail
+
 // 4.1.1 Translation
 template <typename T> constexpr Mat4<T> Translate(T vecx, T vecy, T vecz);
 template <typename T> constexpr Mat4<T> Translate(Vec3<T> const& vec);
@@ -34,6 +46,14 @@ template <typename T> constexpr Mat4<T> ShearZY(T sca);
 // 4.1.5 Concatenation of Transforms
 // Usually we'll want to apply transforms in the following order: scaling (S), rotation (R) and translation (T).
 // Therefore, the composite matrix can be computed as C = TRS.
+// `MultiplyAll` composes whole arrays at once, out[idx] = lhs[idx] * rhs[idx] (e.g. parent * local for every node of
+// a hierarchy level), or one lhs against every rhs (e.g. view * model for every instance). Each product equals the
+// Mat4 * Mat4 one. `out` has the size of the inputs and is either one of them or disjoint from them. With SIMD, f32
+// arrays are prefetched ahead, and outputs larger than the cache are written with non-temporal stores.
+template <typename T> constexpr void MultiplyAll(std::type_identity_t<std::span<Mat4<T> const>> lhs, std::type_identity_t<std::span<Mat4<T> const>> rhs, std::type_identity_t<std::span<Mat4<T>>> out);
+template <std::ranges::contiguous_range M1, std::ranges::contiguous_range M2, std::ranges::contiguous_range O> constexpr void MultiplyAll(M1&& lhs, M2&& rhs, O&& out);
+template <typename T> constexpr void MultiplyAll(Mat4<T> const& lhs, std::type_identity_t<std::span<Mat4<T> const>> rhs, std::type_identity_t<std::span<Mat4<T>>> out);
+template <std::ranges::contiguous_range M, std::ranges::contiguous_range O> constexpr void MultiplyAll(Mat4<detail::RangeValueType<O>> const& lhs, M&& rhs, O&& out);
 
 // 4.1.6 The Rigid-Body Transform
 template <typename T> constexpr Mat4<T> LookAt(Vec3<T> const& camera_pos, Vec3<T> const& up_vec, Vec3<T> const& point_pos);
@@ -41,6 +61,17 @@ template <typename T> constexpr Mat4<T> LookAt(Vec3<T> const& camera_pos, Vec3<T
 // 4.1.7 Normal Transform
 // The traditional answer to transform normal vectors is to use the transposed inverse of the transform. However, the
 // full inverse is not necessary, and occasionally cannot be created.
+// `NormalMatrix` returns the adjugate transpose (the cofactor matrix) of the upper-left 3x3, which only differs from the
+// inverse transpose by the factor 1/det. Normals are usually renormalized after the transform anyway, so the division
+// only happens when `normalize` asks for the exact inverse transpose.
+template <typename T> constexpr Mat3<T> NormalMatrix(Mat4<T> const& mat, bool normalize = false);
+template <typename T> constexpr void    NormalMatrix(std::type_identity_t<std::span<Mat4<T> const>> mats, std::type_identity_t<std::span<Mat3<T>>> out, bool normalize = false);
+template <std::ranges::contiguous_range M, std::ranges::contiguous_range O> constexpr void NormalMatrix(M&& mats, O&& out, bool normalize = false);
+// `TransformNormals` computes the normal matrix once per batch and applies it to every normal. With `renormalize` it
+// uses the adjugate, negated for mirroring transforms, and scales each result back to unit length under the precision
+// policy P (see vec/func.h). Without it, it uses the exact inverse transpose. `out` is either the input itself or disjoint from it.
+template <typename P = Exact, typename T> constexpr void TransformNormals(Mat4<T> const& model, std::type_identity_t<std::span<Vec3<T> const>> normals, std::type_identity_t<std::span<Vec3<T>>> out, bool renormalize = true);
+template <typename P = Exact, typename T> constexpr void TransformNormals(Mat4<T> const& model, std::type_identity_t<std::span<Vec3<T>>> normals, bool renormalize = true);
 
 // 4.1.8 Computation of Inverses
 // - If a matrix is a single transform or a sequence of simple transforms with given parameters, the inverse can be
@@ -49,6 +80,26 @@ template <typename T> constexpr Mat4<T> LookAt(Vec3<T> const& camera_pos, Vec3<T
 //   transpose of the matrix.
 // - If nothing is known, then the adjoint method, Cramer's rule, LU decomposition or Gaussian elimination could be used
 //   to compute the inverse (`::tf::Inverse` is an implementation of the adjoint method).
+// The fast paths below assert their precondition in debug builds, within `eps` for floating-point matrices.
+template <usize R, typename T> constexpr bool IsOrthogonal(Mat<R, R, T> const& mat, T eps = static_cast<T>(1e-4));
+template          <typename T> constexpr bool IsAffine    (Mat4<T>      const& mat, T eps = static_cast<T>(1e-4));
+template          <typename T> constexpr bool IsRigid     (Mat4<T>      const& mat, T eps = static_cast<T>(1e-4));
+
+template          <typename T> constexpr Mat4<T>      InverseAffine    (Mat4<T>      const& mat);
+template          <typename T> constexpr Mat4<T>      InverseRigid     (Mat4<T>      const& mat);
+template <usize R, typename T> constexpr Mat<R, R, T> InverseOrthogonal(Mat<R, R, T> const& mat);
+
+// Applying Transforms
+// Batched `mat * Vec4(point, 1)` and `mat * Vec4(vec, 0)` over Vec3 arrays, without the Vec4 temporaries. The columns
+// are loaded once per batch and each element uses the same right fold as the Mat * Vec product. The projective form
+// divides x, y and z by the resulting w. `out` has the size of the input and is either the input itself or disjoint
+// from it; the two-argument forms transform in place.
+template <typename T> constexpr void TransformPoints          (Mat4<T> const& mat, std::type_identity_t<std::span<Vec3<T> const>> points, std::type_identity_t<std::span<Vec3<T>>> out);
+template <typename T> constexpr void TransformPointsProjective(Mat4<T> const& mat, std::type_identity_t<std::span<Vec3<T> const>> points, std::type_identity_t<std::span<Vec3<T>>> out);
+template <typename T> constexpr void TransformVectors         (Mat4<T> const& mat, std::type_identity_t<std::span<Vec3<T> const>> vecs,   std::type_identity_t<std::span<Vec3<T>>> out);
+template <typename T> constexpr void TransformPoints          (Mat4<T> const& mat, std::type_identity_t<std::span<Vec3<T>>> points);
+template <typename T> constexpr void TransformPointsProjective(Mat4<T> const& mat, std::type_identity_t<std::span<Vec3<T>>> points);
+template <typename T> constexpr void TransformVectors         (Mat4<T> const& mat, std::type_identity_t<std::span<Vec3<T>>> vecs);
 
 /************************
  * Function definitions *
@@ -77,9 +128,149 @@ template <typename T> constexpr Mat4<T> ShearYZ(T sca) { return Mat4<T>(Vec4<T>(
 template <typename T> constexpr Mat4<T> ShearZX(T sca) { return Mat4<T>(Vec4<T>(1, 0, 0, 0), Vec4<T>(0, 1, 0, 0), Vec4<T>(sca, 0, 1, 0), Vec4<T>(0, 0, 0, 1)); }
 template <typename T> constexpr Mat4<T> ShearZY(T sca) { return Mat4<T>(Vec4<T>(1, 0, 0, 0), Vec4<T>(0, 1, 0, 0), Vec4<T>(0, sca, 1, 0), Vec4<T>(0, 0, 0, 1)); }
 
+// 4.1.5 Concatenation of Transforms
+template <typename T> constexpr void MultiplyAll(std::type_identity_t<std::span<Mat4<T> const>> lhs, std::type_identity_t<std::span<Mat4<T> const>> rhs, std::type_identity_t<std::span<Mat4<T>>> out) {
+  assert(lhs.size() == out.size() && rhs.size() == out.size());
+#ifdef TRANSFORM_SIMD_SSE
+  if constexpr (std::is_same_v<T, f32>) {
+    if (!std::is_constant_evaluated() && !out.empty()) return simd::MulBatch(lhs.data()->data(), 16, rhs.data()->data(), out.data()->data(), out.size());
+  }
+#endif
+  for (usize idx = 0; idx < out.size(); ++idx) out[idx] = lhs[idx] * rhs[idx];
+}
+template <std::ranges::contiguous_range M1, std::ranges::contiguous_range M2, std::ranges::contiguous_range O> constexpr void MultiplyAll(M1&& lhs, M2&& rhs, O&& out) { MultiplyAll<detail::RangeValueType<O>>(lhs, rhs, out); }
+template <typename T> constexpr void MultiplyAll(Mat4<T> const& lhs, std::type_identity_t<std::span<Mat4<T> const>> rhs, std::type_identity_t<std::span<Mat4<T>>> out) {
+  assert(rhs.size() == out.size());
+  // A copy, in case lhs is an element of out.
+  Mat4<T> const mat = lhs;
+#ifdef TRANSFORM_SIMD_SSE
+  if constexpr (std::is_same_v<T, f32>) {
+    if (!std::is_constant_evaluated() && !out.empty()) return simd::MulBatch(mat.data(), 0, rhs.data()->data(), out.data()->data(), out.size());
+  }
+#endif
+  for (usize idx = 0; idx < out.size(); ++idx) out[idx] = mat * rhs[idx];
+}
+template <std::ranges::contiguous_range M, std::ranges::contiguous_range O> constexpr void MultiplyAll(Mat4<detail::RangeValueType<O>> const& lhs, M&& rhs, O&& out) { MultiplyAll<detail::RangeValueType<O>>(lhs, rhs, out); }
+
 // 4.1.6 The Rigid-Body Transform
 template <typename T> constexpr Mat4<T> LookAt(Vec3<T> const& camera_pos, Vec3<T> const& up_vec, Vec3<T> const& point_pos) { Vec3<T> z_vec = Normalize(camera_pos - point_pos); Vec3<T> x_vec = Normalize(-Cross(z_vec, up_vec)); Vec3<T> y_vec = Cross(z_vec, x_vec); return ChangeBasis(x_vec, y_vec, z_vec) * Translate(-camera_pos); }
 
+// 4.1.7 Normal Transform
+template <typename T> constexpr Mat3<T> NormalMatrix(Mat4<T> const& mat, bool normalize) {
+  Vec3<T> col0(mat[0]);
+  Vec3<T> col1(mat[1]);
+  Vec3<T> col2(mat[2]);
+  Mat3<T> result(Cross(col1, col2), Cross(col2, col0), Cross(col0, col1));
+  return normalize ? result * (static_cast<T>(1) / Dot(col0, result[0])) : result;
+}
+template <typename T> constexpr void NormalMatrix(std::type_identity_t<std::span<Mat4<T> const>> mats, std::type_identity_t<std::span<Mat3<T>>> out, bool normalize) {
+  assert(mats.size() == out.size());
+  for (usize idx = 0; idx < out.size(); ++idx) out[idx] = NormalMatrix(mats[idx], normalize);
+}
+template <std::ranges::contiguous_range M, std::ranges::contiguous_range O> constexpr void NormalMatrix(M&& mats, O&& out, bool normalize) { NormalMatrix<detail::RangeValueType<O>>(mats, out, normalize); }
+template <typename P, typename T> constexpr void TransformNormals(Mat4<T> const& model, std::type_identity_t<std::span<Vec3<T> const>> normals, std::type_identity_t<std::span<Vec3<T>>> out, bool renormalize) {
+  static_assert(std::is_same_v<P, Exact> || std::is_same_v<P, Fast>);
+  assert(normals.size() == out.size());
+  // The adjugate is det times the inverse transpose, so a mirroring model would flip the normals.
+  Mat3<T> normal_mat = NormalMatrix(model, !renormalize);
+  if (renormalize && Dot(Vec3<T>(model[0]), normal_mat[0]) < T{}) normal_mat = -normal_mat;
+  usize idx = 0;
+#ifdef TRANSFORM_SIMD_SSE
+  if constexpr (std::is_same_v<T, f32>) {
+    if (!std::is_constant_evaluated()) {
+      constexpr simd::Apply kUnit = std::is_same_v<P, Fast> ? simd::Apply::kNormalFast : simd::Apply::kNormal;
+      idx = renormalize ? simd::TransformBatch<kUnit, 3>(normal_mat.data(), normals.data(), out.data(), normals.size())
+                        : simd::TransformBatch<simd::Apply::kVector, 3>(normal_mat.data(), normals.data(), out.data(), normals.size());
+    }
+  }
+#endif
+  for (; idx < normals.size(); ++idx) {
+    Vec3<T> const result = normal_mat[0] * normals[idx][0] + (normal_mat[1] * normals[idx][1] + normal_mat[2] * normals[idx][2]);
+    out[idx] = renormalize ? Normalize<P>(result) : result;
+  }
+}
+template <typename P, typename T> constexpr void TransformNormals(Mat4<T> const& model, std::type_identity_t<std::span<Vec3<T>>> normals, bool renormalize) { TransformNormals<P, T>(model, normals, normals, renormalize); }
+
+// 4.1.8 Computation of Inverses
+template <usize R, typename T> constexpr bool IsOrthogonal(Mat<R, R, T> const& mat, T eps) {
+  for (usize col = 0; col < R; ++col) {
+    for (usize row = 0; row < R; ++row) {
+      T err = Dot(mat[col], mat[row]) - (col == row ? static_cast<T>(1) : T{});
+      if (err < -eps || eps < err) return false;
+    }
+  }
+  return true;
+}
+template <typename T> constexpr bool IsAffine(Mat4<T> const& mat, T eps) {
+  Vec4<T> err = Vec4<T>(mat[0][3], mat[1][3], mat[2][3], mat[3][3] - static_cast<T>(1));
+  for (usize idx = 0; idx < 4; ++idx) if (err[idx] < -eps || eps < err[idx]) return false;
+  return true;
+}
+template <typename T> constexpr bool IsRigid(Mat4<T> const& mat, T eps) { return IsAffine(mat, eps) && IsOrthogonal(Mat3<T>::Embed(mat), eps); }
+
+template <typename T> constexpr Mat4<T> InverseAffine(Mat4<T> const& mat) {
+  assert(IsAffine(mat));
+  Mat3<T> inv = Inverse(Mat3<T>(mat[0][0], mat[0][1], mat[0][2], mat[1][0], mat[1][1], mat[1][2], mat[2][0], mat[2][1], mat[2][2]));
+  return Mat4<T>(inv[0][0], inv[0][1], inv[0][2], 0,
+                 inv[1][0], inv[1][1], inv[1][2], 0,
+                 inv[2][0], inv[2][1], inv[2][2], 0,
+                 -(inv[0][0] * mat[3][0] + inv[1][0] * mat[3][1] + inv[2][0] * mat[3][2]),
+                 -(inv[0][1] * mat[3][0] + inv[1][1] * mat[3][1] + inv[2][1] * mat[3][2]),
+                 -(inv[0][2] * mat[3][0] + inv[1][2] * mat[3][1] + inv[2][2] * mat[3][2]), 1);
+}
+template <typename T> constexpr Mat4<T> InverseRigid(Mat4<T> const& mat) {
+  assert(IsRigid(mat));
+  return Mat4<T>(mat[0][0], mat[1][0], mat[2][0], 0,
+                 mat[0][1], mat[1][1], mat[2][1], 0,
+                 mat[0][2], mat[1][2], mat[2][2], 0,
+                 -(mat[0][0] * mat[3][0] + mat[0][1] * mat[3][1] + mat[0][2] * mat[3][2]),
+                 -(mat[1][0] * mat[3][0] + mat[1][1] * mat[3][1] + mat[1][2] * mat[3][2]),
+                 -(mat[2][0] * mat[3][0] + mat[2][1] * mat[3][1] + mat[2][2] * mat[3][2]), 1);
+}
+template <usize R, typename T> constexpr Mat<R, R, T> InverseOrthogonal(Mat<R, R, T> const& mat) { assert(IsOrthogonal(mat)); return Transpose(mat); }
+
+// Applying Transforms
+template <typename T> constexpr void TransformPoints(Mat4<T> const& mat, std::type_identity_t<std::span<Vec3<T> const>> points, std::type_identity_t<std::span<Vec3<T>>> out) {
+  assert(points.size() == out.size());
+  usize idx = 0;
+#ifdef TRANSFORM_SIMD_SSE
+  if constexpr (std::is_same_v<T, f32>) {
+    if (!std::is_constant_evaluated()) idx = simd::TransformBatch<simd::Apply::kPoint>(mat.data(), points.data(), out.data(), points.size());
+  }
+#endif
+  Vec3<T> const col0(mat[0]), col1(mat[1]), col2(mat[2]), col3(mat[3]);
+  for (; idx < points.size(); ++idx) out[idx] = col0 * points[idx][0] + (col1 * points[idx][1] + (col2 * points[idx][2] + col3));
+}
+template <typename T> constexpr void TransformPointsProjective(Mat4<T> const& mat, std::type_identity_t<std::span<Vec3<T> const>> points, std::type_identity_t<std::span<Vec3<T>>> out) {
+  assert(points.size() == out.size());
+  usize idx = 0;
+#ifdef TRANSFORM_SIMD_SSE
+  if constexpr (std::is_same_v<T, f32>) {
+    if (!std::is_constant_evaluated()) idx = simd::TransformBatch<simd::Apply::kProjective>(mat.data(), points.data(), out.data(), points.size());
+  }
+#endif
+  Vec3<T> const col0(mat[0]), col1(mat[1]), col2(mat[2]), col3(mat[3]);
+  for (; idx < points.size(); ++idx) {
+    Vec3<T> const& point = points[idx];
+    T const w = mat[0][3] * point[0] + (mat[1][3] * point[1] + (mat[2][3] * point[2] + mat[3][3]));
+    out[idx] = (col0 * point[0] + (col1 * point[1] + (col2 * point[2] + col3))) / w;
+  }
+}
+template <typename T> constexpr void TransformVectors(Mat4<T> const& mat, std::type_identity_t<std::span<Vec3<T> const>> vecs, std::type_identity_t<std::span<Vec3<T>>> out) {
+  assert(vecs.size() == out.size());
+  usize idx = 0;
+#ifdef TRANSFORM_SIMD_SSE
+  if constexpr (std::is_same_v<T, f32>) {
+    if (!std::is_constant_evaluated()) idx = simd::TransformBatch<simd::Apply::kVector>(mat.data(), vecs.data(), out.data(), vecs.size());
+  }
+#endif
+  Vec3<T> const col0(mat[0]), col1(mat[1]), col2(mat[2]);
+  for (; idx < vecs.size(); ++idx) out[idx] = col0 * vecs[idx][0] + (col1 * vecs[idx][1] + col2 * vecs[idx][2]);
+}
+template <typename T> constexpr void TransformPoints          (Mat4<T> const& mat, std::type_identity_t<std::span<Vec3<T>>> points) { TransformPoints<T>(mat, points, points); }
+template <typename T> constexpr void TransformPointsProjective(Mat4<T> const& mat, std::type_identity_t<std::span<Vec3<T>>> points) { TransformPointsProjective<T>(mat, points, points); }
+template <typename T> constexpr void TransformVectors         (Mat4<T> const& mat, std::type_identity_t<std::span<Vec3<T>>> vecs)   { TransformVectors<T>(mat, vecs, vecs); }
+
 }  // namespace tf
 
 #endif  // TRANSFORM_TRANSFORM_BASIC_H_
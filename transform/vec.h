@@ -1,11 +1,13 @@
 #ifndef TRANSFORM_VEC_H_
 #define TRANSFORM_VEC_H_
 
+#include "transform/vec/aligned.h"
 #include "transform/vec/func.h"
 #include "transform/vec/vec.h"
 #include "transform/vec/vec1.h"
 #include "transform/vec/vec2.h"
 #include "transform/vec/vec3.h"
+#include "transform/vec/vec3a.h"
 #include "transform/vec/vec4.h"
 #include "transform/vec/vecn.h"
 
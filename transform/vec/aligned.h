@@ -0,0 +1,72 @@
+#ifndef TRANSFORM_VEC_ALIGNED_H_
+#define TRANSFORM_VEC_ALIGNED_H_
+
+#include <algorithm>
+#include <bit>
+#include <type_traits>
+
+#include "transform/types.h"
+#include "transform/vec/vecn.h"
+
+namespace tf {
+
+// Smallest power of two that holds the whole vector, capped at a cache line.
+template <usize L, typename T> inline constexpr usize kVecAlignment = std::min<usize>(std::bit_ceil(L * sizeof(T)), 64);
+
+// Over-aligned Vec. It adds no members, so it binds to Vec<L, T> const& and
+// converts back from a packed Vec at no cost. Every Vec operator accepts it.
+template <usize L, typename T, usize A = kVecAlignment<L, T>> class alignas(A) AlignedVec : public Vec<L, T> {
+  static_assert(std::has_single_bit(A) && A >= alignof(Vec<L, T>));
+
+ public:
+  // --- Types ---
+  using PackedType = Vec<L, T>;
+
+  // --- Implicit basic constructors ---
+  constexpr AlignedVec() noexcept;
+  constexpr AlignedVec(AlignedVec const& vec)     = default;
+  constexpr AlignedVec(AlignedVec&& vec) noexcept = default;
+
+  constexpr AlignedVec(Vec<L, T> const& vec) noexcept;  // NOLINT(*-explicit-constructor)
+
+  // --- Conversion constructors ---
+  using Vec<L, T>::Vec;
+
+  // --- Destructor ---
+  inline ~AlignedVec() noexcept = default;
+
+  // --- Packed access ---
+  constexpr Vec<L, T> &      packed()       noexcept;  // NOLINT(*-identifier-naming)
+  constexpr Vec<L, T> const& packed() const noexcept;  // NOLINT(*-identifier-naming)
+
+  // --- Unary operators ---
+  constexpr AlignedVec& operator=(AlignedVec const& vec)     = default;
+  constexpr AlignedVec& operator=(AlignedVec&& vec) noexcept = default;
+};
+
+// --- Alias ---
+template <typename T> using AlignedVec2 = AlignedVec<2, T>;
+template <typename T> using AlignedVec3 = AlignedVec<3, T>;
+template <typename T> using AlignedVec4 = AlignedVec<4, T>;
+
+// --- Layout ---
+static_assert(alignof(AlignedVec4<f32>) == 16 && sizeof(AlignedVec4<f32>) == sizeof(Vec4<f32>));
+static_assert(alignof(AlignedVec4<f64>) == 32 && sizeof(AlignedVec4<f64>) == sizeof(Vec4<f64>));
+static_assert(std::is_trivially_copyable_v<AlignedVec4<f32>> && std::is_standard_layout_v<AlignedVec4<f32>>);
+
+/************************
+ * Function definitions *
+ ************************/
+
+// --- Implicit basic constructors ---
+template <usize L, typename T, usize A> constexpr AlignedVec<L, T, A>::AlignedVec() noexcept : Vec<L, T>() {}
+
+template <usize L, typename T, usize A> constexpr AlignedVec<L, T, A>::AlignedVec(Vec<L, T> const& vec) noexcept : Vec<L, T>(vec) {}
+
+// --- Packed access ---
+template <usize L, typename T, usize A> constexpr Vec<L, T> &      AlignedVec<L, T, A>::packed()       noexcept { return *this; }  // NOLINT(*-identifier-naming)
+template <usize L, typename T, usize A> constexpr Vec<L, T> const& AlignedVec<L, T, A>::packed() const noexcept { return *this; }  // NOLINT(*-identifier-naming)
+
+}  // namespace tf
+
+#endif  // TRANSFORM_VEC_ALIGNED_H_
@@ -2,13 +2,31 @@
 #define TRANSFORM_VEC_FUNC_H_
 
 #include <cmath>
+#include <concepts>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 #include "transform/types.h"
+#include "transform/simd/vec4.h"
 #include "transform/vec/vec.h"
 #include "transform/vec/vec3.h"
 
 namespace tf {
 
+// --- Precision policies ---
+// `Exact` divides by a correctly rounded square root, like the policy-free overloads. `Fast` multiplies by a
+// reciprocal square root instead; with the SIMD backend, f32 takes it from the hardware estimate refined by one
+// Newton-Raphson step. Every component then stays within kFastMaxUlp units in the last place of the correctly rounded
+// result (5 is the worst seen over a million random f32 vectors; the estimate differs between CPU vendors).
+struct Exact {};
+struct Fast {};
+
+inline constexpr u32 kFastMaxUlp = 8;
+
+template <typename P> inline constexpr bool kIsPolicy = std::is_same_v<P, Exact> || std::is_same_v<P, Fast>;
+
 template <usize L, typename T> constexpr        T  Length   (Vec<L, T> const& vec);
 template <usize L, typename T> constexpr Vec<L, T> Normalize(Vec<L, T> const& vec);
 template <usize L, typename T> constexpr        T  Sum      (Vec<L, T> const& vec);
@@ -17,19 +35,107 @@ template          <typename T> constexpr Vec<3, T> Cross   (Vec<3, T> const& vec
 template <usize L, typename T> constexpr        T  Dot     (Vec<L, T> const& vec1, Vec<L, T> const& vec2);
 template <usize L, typename T> constexpr        T  Distance(Vec<L, T> const& vec1, Vec<L, T> const& vec2);
 
+// Lane masks: `Equal` and `NotEqual` compare per component, where `==` and `!=` reduce to a single bool. `Bitmask` sets
+// bit idx for every true lane, and `Select` takes vec1 where the mask is true and vec2 elsewhere.
+template <usize L, typename T> constexpr Vec<L, bool> Equal   (Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+template <usize L, typename T> constexpr Vec<L, bool> NotEqual(Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+template <usize L>             constexpr bool         Any     (Vec<L, bool> const& mask);
+template <usize L>             constexpr bool         All     (Vec<L, bool> const& mask);
+template <usize L>             constexpr u64          Bitmask (Vec<L, bool> const& mask);
+template <usize L, typename T> constexpr Vec<L, T>    Select  (Vec<L, bool> const& mask, Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+
+template <typename P,         usize L, typename T> requires kIsPolicy<P> constexpr        T  Length      (Vec<L, T> const& vec);
+template <typename P,         usize L, typename T> requires kIsPolicy<P> constexpr Vec<L, T> Normalize   (Vec<L, T> const& vec);
+template <typename P,         usize L, typename T> requires kIsPolicy<P> constexpr        T  Distance    (Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+template <typename P = Exact, usize L, typename T> requires kIsPolicy<P> constexpr void      NormalizeAll(std::span<Vec<L, T>> vecs);
+
+// Saturating integer arithmetic for pixel and sample data: results clamp to the range of T instead of wrapping.
+// `MulHigh` keeps the upper half of the double-width product and `Average` rounds halves up, like pmulhw and pavgb.
+// `SaturateCast` narrows with the same clamping; widening is the plain converting constructor. Lanes of up to 32 bits.
+template <std::integral T> constexpr T AddSat (T sca1, T sca2);
+template <std::integral T> constexpr T SubSat (T sca1, T sca2);
+template <std::integral T> constexpr T MulHigh(T sca1, T sca2);
+template <std::integral T> constexpr T Average(T sca1, T sca2);
+
+template <usize L, std::integral T> constexpr Vec<L, T> AddSat (Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+template <usize L, std::integral T> constexpr Vec<L, T> SubSat (Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+template <usize L, std::integral T> constexpr Vec<L, T> MulHigh(Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+template <usize L, std::integral T> constexpr Vec<L, T> Average(Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+
+template <std::integral U,          std::integral T> constexpr        U  SaturateCast(T sca);
+template <std::integral U, usize L, std::integral T> constexpr Vec<L, U> SaturateCast(Vec<L, T> const& vec);
+
 /************************
  * Function definitions *
  ************************/
 
-template <usize L, typename T> constexpr        T  Length   (Vec<L, T> const& vec) { return static_cast<T>(std::sqrt(Dot(vec, vec))); }
+template <usize L, typename T> constexpr        T  Length   (Vec<L, T> const& vec) { using std::sqrt; return static_cast<T>(sqrt(Dot(vec, vec))); }
 template <usize L, typename T> constexpr Vec<L, T> Normalize(Vec<L, T> const& vec) { return vec / Length(vec); }
-template          <typename T> constexpr        T  Sum      (Vec<1, T> const& vec) { return vec.head(); }
-template <usize L, typename T> constexpr        T  Sum      (Vec<L, T> const& vec) { return vec.head() + Sum(vec.tail()); }
+template <usize L, typename T> constexpr        T  Sum      (Vec<L, T> const& vec) { T result = vec[L - 1]; for (usize idx = L - 1; idx-- > 0;) result = static_cast<T>(vec[idx] + result); return result; }
 
 template          <typename T> constexpr Vec<3, T> Cross   (Vec<3, T> const& vec1, Vec<3, T> const& vec2) { return Vec<3, T>(vec1.y() * vec2.z() - vec1.z() * vec2.y(), vec1.z() * vec2.x() - vec1.x() * vec2.z(), vec1.x() * vec2.y() - vec1.y() * vec2.x()); }
 template <usize L, typename T> constexpr        T  Dot     (Vec<L, T> const& vec1, Vec<L, T> const& vec2) { return Sum(vec1 * vec2); }
 template <usize L, typename T> constexpr        T  Distance(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { return Length(vec2 - vec1); }
 
+template <usize L, typename T> constexpr Vec<L, bool> Equal   (Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = vec1[idx] == vec2[idx]; return result; }
+template <usize L, typename T> constexpr Vec<L, bool> NotEqual(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = vec1[idx] != vec2[idx]; return result; }
+template <usize L>             constexpr bool         Any     (Vec<L, bool> const& mask) { bool result = false; for (usize idx = 0; idx < L; ++idx) result |= mask[idx]; return result; }
+template <usize L>             constexpr bool         All     (Vec<L, bool> const& mask) { bool result = true;  for (usize idx = 0; idx < L; ++idx) result &= mask[idx]; return result; }
+template <usize L>             constexpr u64          Bitmask (Vec<L, bool> const& mask) { static_assert(L <= 64); u64 result = 0; for (usize idx = 0; idx < L; ++idx) result |= static_cast<u64>(mask[idx]) << idx; return result; }
+template <usize L, typename T> constexpr Vec<L, T>    Select  (Vec<L, bool> const& mask, Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = mask[idx] ? vec1[idx] : vec2[idx]; return result; }
+
+template <typename P, usize L, typename T> requires kIsPolicy<P> constexpr T Length(Vec<L, T> const& vec) {
+#ifdef TRANSFORM_SIMD_SSE
+  if constexpr (std::is_same_v<P, Fast> && std::is_same_v<T, f32>) {
+    if (!std::is_constant_evaluated()) return simd::SqrtFast(Dot(vec, vec));
+  }
+#endif
+  return Length(vec);
+}
+template <typename P, usize L, typename T> requires kIsPolicy<P> constexpr Vec<L, T> Normalize(Vec<L, T> const& vec) {
+  if constexpr (std::is_same_v<P, Fast>) {
+    static_assert(std::is_floating_point_v<T>);
+#ifdef TRANSFORM_SIMD_SSE
+    if constexpr (L == 4 && std::is_same_v<T, f32>) {
+      if (!std::is_constant_evaluated()) return simd::NormalizeFast(vec);
+    }
+#endif
+    return vec * (static_cast<T>(1) / Length(vec));
+  }
+  return Normalize(vec);
+}
+template <typename P, usize L, typename T> requires kIsPolicy<P> constexpr T Distance(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { return Length<P>(vec2 - vec1); }
+
+template <typename P, usize L, typename T> requires kIsPolicy<P> constexpr void NormalizeAll(std::span<Vec<L, T>> vecs) {
+#ifdef TRANSFORM_SIMD_SSE
+  if constexpr (L == 4 && std::is_same_v<T, f32>) {
+    if (!std::is_constant_evaluated()) return simd::NormalizeAll<std::is_same_v<P, Fast>>(vecs.data(), vecs.size());
+  }
+#endif
+  for (Vec<L, T>& vec : vecs) vec = Normalize<P>(vec);
+}
+
+template <std::integral T> constexpr T AddSat (T sca1, T sca2) { static_assert(sizeof(T) <= 4); return SaturateCast<T>(static_cast<i64>(sca1) + static_cast<i64>(sca2)); }
+template <std::integral T> constexpr T SubSat (T sca1, T sca2) { static_assert(sizeof(T) <= 4); return SaturateCast<T>(static_cast<i64>(sca1) - static_cast<i64>(sca2)); }
+template <std::integral T> constexpr T MulHigh(T sca1, T sca2) {
+  static_assert(sizeof(T) <= 4);
+  // The product of two u32 does not fit in i64.
+  using Wider = std::conditional_t<std::is_signed_v<T>, i64, u64>;
+  return static_cast<T>((static_cast<Wider>(sca1) * static_cast<Wider>(sca2)) >> (8 * sizeof(T)));
+}
+template <std::integral T> constexpr T Average(T sca1, T sca2) { static_assert(sizeof(T) <= 4); return static_cast<T>((static_cast<i64>(sca1) + static_cast<i64>(sca2) + 1) >> 1); }
+
+template <usize L, std::integral T> constexpr Vec<L, T> AddSat (Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = AddSat (vec1[idx], vec2[idx]); return result; }
+template <usize L, std::integral T> constexpr Vec<L, T> SubSat (Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = SubSat (vec1[idx], vec2[idx]); return result; }
+template <usize L, std::integral T> constexpr Vec<L, T> MulHigh(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = MulHigh(vec1[idx], vec2[idx]); return result; }
+template <usize L, std::integral T> constexpr Vec<L, T> Average(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = Average(vec1[idx], vec2[idx]); return result; }
+
+template <std::integral U, std::integral T> constexpr U SaturateCast(T sca) {
+  if (std::in_range<U>(sca)) return static_cast<U>(sca);
+  return std::cmp_less(sca, 0) ? std::numeric_limits<U>::min() : std::numeric_limits<U>::max();
+}
+template <std::integral U, usize L, std::integral T> constexpr Vec<L, U> SaturateCast(Vec<L, T> const& vec) { Vec<L, U> result; for (usize idx = 0; idx < L; ++idx) result[idx] = SaturateCast<U>(vec[idx]); return result; }
+
 }  // namespace tf
 
 #endif  // TRANSFORM_VEC_FUNC_H_
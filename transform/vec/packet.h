@@ -0,0 +1,186 @@
+#ifndef TRANSFORM_VEC_PACKET_H_
+#define TRANSFORM_VEC_PACKET_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <span>
+#include <type_traits>
+
+#include "transform/types.h"
+#include "transform/simd/config.h"
+#include "transform/simd/soa.h"
+#include "transform/vec/func.h"
+#include "transform/vec/vec3.h"
+#include "transform/vec/vecn.h"
+
+namespace tf {
+
+// N values of T processed as one, lane by lane. `Wide` models a scalar: it broadcasts from T, supports the arithmetic
+// operators and `sqrt`, and compares equal only when every lane does. A Vec of Wide lanes is therefore a packet of N
+// vectors in transposed (component-major) layout, and the generic Vec operators and the functions of vec/func.h
+// (Dot, Cross, Length, Normalize, ...) apply to all N vectors at once. The lane loops have a fixed trip count, which
+// compilers turn into whole vector instructions. Like std::experimental::simd, a default constructed Wide leaves its
+// lanes unset, so the temporaries of the generic Vec operators are never zero-filled; broadcast T{} for zeros.
+// The lanes are aligned to at most 16 bytes: the generic Vec operators take their scalar by value, and a wider alignment
+// changes how GCC passes it (the -Wpsabi note) and makes every such call realign the stack, while AVX loads do not need
+// it.
+template <typename T, usize N> class Wide {
+  static_assert(std::is_arithmetic_v<T> && N > 0 && (N & (N - 1)) == 0);
+
+  // --- Data ---
+  alignas(std::min<usize>(N * sizeof(T), 16)) T data_[N];
+
+ public:
+  // --- Types ---
+  using ValueType  = T;
+  using Type       = Wide<T, N>;
+  using LengthType = usize;
+
+  // --- Component access ---
+  static constexpr LengthType Length() noexcept { return N; }
+
+  constexpr T &      operator[](LengthType idx)       noexcept { assert(idx < N); return data_[idx]; }
+  constexpr T const& operator[](LengthType idx) const noexcept { assert(idx < N); return data_[idx]; }
+
+  constexpr T      * data()       noexcept { return data_; }  // NOLINT(*-identifier-naming)
+  constexpr T const* data() const noexcept { return data_; }  // NOLINT(*-identifier-naming)
+
+  // --- Implicit basic constructors ---
+  constexpr Wide() noexcept {}  // NOLINT(*-member-init)
+  constexpr Wide(T sca) noexcept { for (usize idx = 0; idx < N; ++idx) data_[idx] = sca; }  // NOLINT(*-explicit-*)
+
+  // --- Unary arithmetic operators ---
+  constexpr Wide& operator+=(Wide const& wide) noexcept { for (usize idx = 0; idx < N; ++idx) data_[idx] = static_cast<T>(data_[idx] + wide.data_[idx]); return *this; }
+  constexpr Wide& operator-=(Wide const& wide) noexcept { for (usize idx = 0; idx < N; ++idx) data_[idx] = static_cast<T>(data_[idx] - wide.data_[idx]); return *this; }
+  constexpr Wide& operator*=(Wide const& wide) noexcept { for (usize idx = 0; idx < N; ++idx) data_[idx] = static_cast<T>(data_[idx] * wide.data_[idx]); return *this; }
+  constexpr Wide& operator/=(Wide const& wide) noexcept { for (usize idx = 0; idx < N; ++idx) data_[idx] = static_cast<T>(data_[idx] / wide.data_[idx]); return *this; }
+
+  friend constexpr Wide operator-(Wide const& wide) noexcept { Wide result; for (usize idx = 0; idx < N; ++idx) result.data_[idx] = static_cast<T>(-wide.data_[idx]); return result; }
+
+  // --- Binary arithmetic operators ---
+  friend constexpr Wide operator+(Wide const& wide1, Wide const& wide2) noexcept { Wide result; for (usize idx = 0; idx < N; ++idx) result.data_[idx] = static_cast<T>(wide1.data_[idx] + wide2.data_[idx]); return result; }
+  friend constexpr Wide operator-(Wide const& wide1, Wide const& wide2) noexcept { Wide result; for (usize idx = 0; idx < N; ++idx) result.data_[idx] = static_cast<T>(wide1.data_[idx] - wide2.data_[idx]); return result; }
+  friend constexpr Wide operator*(Wide const& wide1, Wide const& wide2) noexcept { Wide result; for (usize idx = 0; idx < N; ++idx) result.data_[idx] = static_cast<T>(wide1.data_[idx] * wide2.data_[idx]); return result; }
+  friend constexpr Wide operator/(Wide const& wide1, Wide const& wide2) noexcept { Wide result; for (usize idx = 0; idx < N; ++idx) result.data_[idx] = static_cast<T>(wide1.data_[idx] / wide2.data_[idx]); return result; }
+
+  // --- Boolean operators ---
+  friend constexpr bool operator==(Wide const& wide1, Wide const& wide2) noexcept { for (usize idx = 0; idx < N; ++idx) if (!(wide1.data_[idx] == wide2.data_[idx])) return false; return true; }
+  friend constexpr bool operator!=(Wide const& wide1, Wide const& wide2) noexcept { return !(wide1 == wide2); }
+
+  // --- Functions ---
+  // Found through argument-dependent lookup by `Length` and `Normalize`. std::sqrt sets errno, which keeps compilers
+  // from vectorizing it, so SSE takes the packed square root directly.
+  friend Wide sqrt(Wide const& wide) noexcept {  // NOLINT(*-identifier-naming)
+    Wide result;
+#ifdef TRANSFORM_SIMD_SSE
+    if constexpr ((std::is_same_v<T, f32> && N % 4 == 0) || (std::is_same_v<T, f64> && N % 2 == 0)) {
+      simd::Sqrt(wide.data_, result.data_, N);
+      return result;
+    }
+#endif
+    for (usize idx = 0; idx < N; ++idx) result.data_[idx] = static_cast<T>(std::sqrt(wide.data_[idx]));
+    return result;
+  }
+};
+
+namespace detail {
+template <typename V, usize N> struct PacketOf { using Type = Wide<V, N>; };
+template <usize L, typename T, usize N> struct PacketOf<Vec<L, T>, N> { using Type = Vec<L, Wide<T, N>>; };
+}  // namespace detail
+
+// N values of a scalar or a Vec in one packet: Packet<f32, 8> is Wide<f32, 8> and Packet<Vec3<f32>, 8> is
+// Vec<3, Wide<f32, 8>>, eight Vec3 with all x lanes first, then all y and all z lanes.
+template <typename V, usize N> using Packet = typename detail::PacketOf<V, N>::Type;
+
+template <typename T> using Vec3x4 = Packet<Vec3<T>, 4>;
+template <typename T> using Vec3x8 = Packet<Vec3<T>, 8>;
+
+// --- Binary arithmetic operators ---
+// A packet against a plain scalar, which the Vec operators would not deduce.
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator+(Vec<L, Wide<T, N>> const& vec, T sca);
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator-(Vec<L, Wide<T, N>> const& vec, T sca);
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator*(Vec<L, Wide<T, N>> const& vec, T sca);
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator/(Vec<L, Wide<T, N>> const& vec, T sca);
+
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator+(T sca, Vec<L, Wide<T, N>> const& vec);
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator-(T sca, Vec<L, Wide<T, N>> const& vec);
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator*(T sca, Vec<L, Wide<T, N>> const& vec);
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator/(T sca, Vec<L, Wide<T, N>> const& vec);
+
+// --- Conversions ---
+// `LoadPacket` transposes the first N Vecs of `vecs` into a packet; lanes past the end of a shorter span stay zero.
+// `StorePacket` writes the first min(N, vecs.size()) lanes back. With SSE, f32 Vec3 packets of four or eight lanes
+// move through register transposes.
+template <usize N, typename V>          constexpr Packet<std::remove_const_t<V>, N> LoadPacket (std::span<V> vecs);
+template <usize L, typename T, usize N> constexpr void                              StorePacket(Vec<L, Wide<T, N>> const& packet, std::span<Vec<L, T>> vecs);
+
+// Lane idx of a packet as a plain Vec, and the reverse.
+template <usize L, typename T, usize N> constexpr Vec<L, T> GetLane(Vec<L, Wide<T, N>> const& packet, usize idx);
+template <usize L, typename T, usize N> constexpr void      SetLane(Vec<L, Wide<T, N>>& packet, usize idx, Vec<L, T> const& vec);
+
+/************************
+ * Function definitions *
+ ************************/
+
+// --- Binary arithmetic operators ---
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator+(Vec<L, Wide<T, N>> const& vec, T sca) { return vec + Wide<T, N>(sca); }
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator-(Vec<L, Wide<T, N>> const& vec, T sca) { return vec - Wide<T, N>(sca); }
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator*(Vec<L, Wide<T, N>> const& vec, T sca) { return vec * Wide<T, N>(sca); }
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator/(Vec<L, Wide<T, N>> const& vec, T sca) { return vec / Wide<T, N>(sca); }
+
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator+(T sca, Vec<L, Wide<T, N>> const& vec) { return Wide<T, N>(sca) + vec; }
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator-(T sca, Vec<L, Wide<T, N>> const& vec) { return Wide<T, N>(sca) - vec; }
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator*(T sca, Vec<L, Wide<T, N>> const& vec) { return Wide<T, N>(sca) * vec; }
+template <usize L, typename T, usize N> constexpr Vec<L, Wide<T, N>> operator/(T sca, Vec<L, Wide<T, N>> const& vec) { return Wide<T, N>(sca) / vec; }
+
+// --- Conversions ---
+#ifdef TRANSFORM_SIMD_SSE
+namespace detail {
+// The register transposes read and write all N vectors, so they stay out of line (see TRANSFORM_NOINLINE).
+template <usize N> TRANSFORM_NOINLINE void LoadPacket3(Vec3<f32> const* vecs, Vec<3, Wide<f32, N>>& packet) noexcept {
+  f32* const dst[3] = {packet[0].data(), packet[1].data(), packet[2].data()};
+  simd::Deinterleave<3>(vecs->data(), dst, N);
+}
+template <usize N> TRANSFORM_NOINLINE void StorePacket3(Vec<3, Wide<f32, N>> const& packet, Vec3<f32>* vecs) noexcept {
+  f32 const* const src[3] = {packet[0].data(), packet[1].data(), packet[2].data()};
+  simd::Interleave<3>(src, vecs->data(), N);
+}
+}  // namespace detail
+#endif
+
+template <usize N, typename V> constexpr Packet<std::remove_const_t<V>, N> LoadPacket(std::span<V> vecs) {
+  using Vector = std::remove_const_t<V>;
+  using T      = typename Vector::ValueType;
+  constexpr usize kLength = Vector::Length();
+#ifdef TRANSFORM_SIMD_SSE
+  if constexpr (kLength == 3 && std::is_same_v<T, f32> && N % 4 == 0) {
+    if (!std::is_constant_evaluated() && vecs.size() >= N) {
+      Packet<Vector, N> result;
+      detail::LoadPacket3<N>(vecs.data(), result);
+      return result;
+    }
+  }
+#endif
+  Packet<Vector, N> result;
+  for (usize com = 0; com < kLength; ++com) result[com] = Wide<T, N>(T{});
+  for (usize idx = 0; idx < N && idx < vecs.size(); ++idx)
+    for (usize com = 0; com < kLength; ++com) result[com][idx] = static_cast<T>(vecs[idx][com]);
+  return result;
+}
+
+template <usize L, typename T, usize N> constexpr void StorePacket(Vec<L, Wide<T, N>> const& packet, std::span<Vec<L, T>> vecs) {
+#ifdef TRANSFORM_SIMD_SSE
+  if constexpr (L == 3 && std::is_same_v<T, f32> && N % 4 == 0) {
+    if (!std::is_constant_evaluated() && vecs.size() >= N) return detail::StorePacket3<N>(packet, vecs.data());
+  }
+#endif
+  for (usize idx = 0; idx < N && idx < vecs.size(); ++idx) vecs[idx] = GetLane(packet, idx);
+}
+
+template <usize L, typename T, usize N> constexpr Vec<L, T> GetLane(Vec<L, Wide<T, N>> const& packet, usize idx) { Vec<L, T> result; for (usize com = 0; com < L; ++com) result[com] = packet[com][idx]; return result; }
+template <usize L, typename T, usize N> constexpr void      SetLane(Vec<L, Wide<T, N>>& packet, usize idx, Vec<L, T> const& vec) { for (usize com = 0; com < L; ++com) packet[com][idx] = vec[com]; }
+
+}  // namespace tf
+
+#endif  // TRANSFORM_VEC_PACKET_H_
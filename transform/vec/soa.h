@@ -0,0 +1,301 @@
+#ifndef TRANSFORM_VEC_SOA_H_
+#define TRANSFORM_VEC_SOA_H_
+
+#include <cassert>
+#include <cmath>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "transform/types.h"
+#include "transform/simd/config.h"
+#include "transform/simd/soa.h"
+#include "transform/vec/vecn.h"
+
+#ifdef TRANSFORM_SIMD_PORTABLE_STDX
+// Same GCC 12 AVX-512 warnings as in `transform/simd/vecn.h`.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 13
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <experimental/simd>
+#pragma GCC diagnostic pop
+#else
+#include <experimental/simd>
+#endif
+#endif
+
+// Declares the iterations of the next loop independent, so it vectorizes without runtime alias checks.
+#if defined(__clang__)
+#define TRANSFORM_IVDEP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#define TRANSFORM_IVDEP _Pragma("GCC ivdep")
+#elif defined(_MSC_VER)
+#define TRANSFORM_IVDEP __pragma(loop(ivdep))
+#else
+#define TRANSFORM_IVDEP
+#endif
+
+namespace tf {
+
+namespace simd {
+
+// Lanes per block of the generic loop. A fixed trip count lets compilers vectorize it at -O2, which only takes loops
+// the vector code replaces entirely.
+inline constexpr usize kSoaBlock = 16;
+
+// dst[idx] = op(srcs[idx]...) for every idx < count. `dst` may be one of the sources, but never shifted against it.
+// With the portable backend `op` receives native std::experimental::simd packs, otherwise scalars, so it is written
+// once as a generic lambda.
+template <typename T, typename Op, typename... S> void Lanes(usize count, T* dst, Op op, S const*... srcs) noexcept;
+
+}  // namespace simd
+
+// Structure of arrays: L contiguous component arrays of equal size instead of an array of Vec<L, T>. Batched
+// operations then run over whole components, and every lane matches the Vec operation bit for bit. The exception is
+// a build that contracts multiply-adds (e.g. GCC with -mfma, where -ffp-contract=fast is the default): the compiler
+// may fuse the products of Cross, Dot, Length and Normalize differently in the two loops, so those agree to the last
+// bit of the products instead.
+template <usize L, typename T> class VecSoa {
+  static_assert(L > 0);
+
+  // --- Data ---
+  std::vector<T> data_[L];
+
+ public:
+  // --- Types ---
+  using ValueType   = T;
+  using Type        = VecSoa<L, T>;
+  using LengthType  = usize;
+  using ElementType = Vec<L, T>;
+
+  // --- Component access ---
+  static constexpr LengthType Length() noexcept { return L; }
+
+  std::span<T      > operator[](LengthType com)       noexcept;
+  std::span<T const> operator[](LengthType com) const noexcept;
+
+  usize size()  const noexcept;  // NOLINT(*-identifier-naming)
+  bool  empty() const noexcept;  // NOLINT(*-identifier-naming)
+
+  void resize(usize size);       // NOLINT(*-identifier-naming)
+  void reserve(usize capacity);  // NOLINT(*-identifier-naming)
+  void clear() noexcept;         // NOLINT(*-identifier-naming)
+
+  // --- Element access ---
+  Vec<L, T> Get(usize idx) const noexcept;
+  void      Set(usize idx, Vec<L, T> const& vec) noexcept;
+
+  // --- Implicit basic constructors ---
+  VecSoa() = default;
+
+  // --- Explicit basic constructors ---
+  explicit VecSoa(usize size);
+
+  // --- Conversion constructors ---
+  explicit VecSoa(std::span<Vec<L, T> const> vecs);
+
+  // --- Conversions ---
+  // One pass over the Vecs; Load resizes, Store expects vecs.size() == size(). With SSE, f32 Vec3 and Vec4 move four
+  // at a time through register transposes.
+  void Load (std::span<Vec<L, T> const> vecs);
+  void Store(std::span<Vec<L, T>>       vecs) const noexcept;
+
+  // --- Unary arithmetic operators ---
+  VecSoa& operator+=(T sca) noexcept;
+  VecSoa& operator-=(T sca) noexcept;
+  VecSoa& operator*=(T sca) noexcept;
+  VecSoa& operator/=(T sca) noexcept;
+
+  VecSoa& operator+=(Vec<L, T> const& vec) noexcept;
+  VecSoa& operator-=(Vec<L, T> const& vec) noexcept;
+  VecSoa& operator*=(Vec<L, T> const& vec) noexcept;
+  VecSoa& operator/=(Vec<L, T> const& vec) noexcept;
+
+  VecSoa& operator+=(VecSoa const& soa) noexcept;
+  VecSoa& operator-=(VecSoa const& soa) noexcept;
+  VecSoa& operator*=(VecSoa const& soa) noexcept;
+  VecSoa& operator/=(VecSoa const& soa) noexcept;
+
+  // *this += soa * sca without the temporary, e.g. pos.AddScaled(vel, dt).
+  VecSoa& AddScaled(VecSoa const& soa, T sca) noexcept;
+};
+
+// --- Alias ---
+template <typename T> using Vec3Soa = VecSoa<3, T>;
+template <typename T> using Vec4Soa = VecSoa<4, T>;
+
+// --- Unary arithmetic operators ---
+template <usize L, typename T> VecSoa<L, T> operator-(VecSoa<L, T> const& soa);
+
+// --- Binary arithmetic operators ---
+template <usize L, typename T> VecSoa<L, T> operator+(VecSoa<L, T> const& soa, T sca);
+template <usize L, typename T> VecSoa<L, T> operator-(VecSoa<L, T> const& soa, T sca);
+template <usize L, typename T> VecSoa<L, T> operator*(VecSoa<L, T> const& soa, T sca);
+template <usize L, typename T> VecSoa<L, T> operator/(VecSoa<L, T> const& soa, T sca);
+
+template <usize L, typename T> VecSoa<L, T> operator*(T sca, VecSoa<L, T> const& soa);
+
+template <usize L, typename T> VecSoa<L, T> operator+(VecSoa<L, T> const& soa1, VecSoa<L, T> const& soa2);
+template <usize L, typename T> VecSoa<L, T> operator-(VecSoa<L, T> const& soa1, VecSoa<L, T> const& soa2);
+template <usize L, typename T> VecSoa<L, T> operator*(VecSoa<L, T> const& soa1, VecSoa<L, T> const& soa2);
+template <usize L, typename T> VecSoa<L, T> operator/(VecSoa<L, T> const& soa1, VecSoa<L, T> const& soa2);
+
+// --- Functions ---
+// The same folds as `transform/vec/func.h`, one result per element.
+template <usize L, typename T> std::vector<T> Dot   (VecSoa<L, T> const& soa1, VecSoa<L, T> const& soa2);
+template <usize L, typename T> std::vector<T> Length(VecSoa<L, T> const& soa);
+template          <typename T> VecSoa<3, T>   Cross (VecSoa<3, T> const& soa1, VecSoa<3, T> const& soa2);
+template <usize L, typename T> VecSoa<L, T>   Normalize(VecSoa<L, T> const& soa);
+
+/************************
+ * Function definitions *
+ ************************/
+
+namespace simd {
+
+template <typename T, typename Op, typename... S> void Lanes(usize count, T* dst, Op op, S const*... srcs) noexcept {
+  usize idx = 0;
+#ifdef TRANSFORM_SIMD_PORTABLE_STDX
+  if constexpr (Portable<T>) {
+    using Pack = stdx::native_simd<T>;
+    for (; idx + Pack::size() <= count; idx += Pack::size()) Pack(op(Pack(srcs + idx, stdx::element_aligned)...)).copy_to(dst + idx, stdx::element_aligned);
+  }
+#endif
+  for (; idx + kSoaBlock <= count; idx += kSoaBlock) {
+    TRANSFORM_IVDEP
+    for (usize lane = 0; lane < kSoaBlock; ++lane) dst[idx + lane] = static_cast<T>(op(srcs[idx + lane]...));
+  }
+  for (; idx < count; ++idx) dst[idx] = static_cast<T>(op(srcs[idx]...));
+}
+
+}  // namespace simd
+
+// --- Component access ---
+template <usize L, typename T> std::span<T      > VecSoa<L, T>::operator[](LengthType com)       noexcept { assert(com < L); return data_[com]; }
+template <usize L, typename T> std::span<T const> VecSoa<L, T>::operator[](LengthType com) const noexcept { assert(com < L); return data_[com]; }
+
+template <usize L, typename T> usize VecSoa<L, T>::size()  const noexcept { return data_[0].size(); }   // NOLINT(*-identifier-naming)
+template <usize L, typename T> bool  VecSoa<L, T>::empty() const noexcept { return data_[0].empty(); }  // NOLINT(*-identifier-naming)
+
+template <usize L, typename T> void VecSoa<L, T>::resize(usize size)      { for (std::vector<T>& com : data_) com.resize(size); }       // NOLINT(*-identifier-naming)
+template <usize L, typename T> void VecSoa<L, T>::reserve(usize capacity) { for (std::vector<T>& com : data_) com.reserve(capacity); }  // NOLINT(*-identifier-naming)
+template <usize L, typename T> void VecSoa<L, T>::clear() noexcept        { for (std::vector<T>& com : data_) com.clear(); }            // NOLINT(*-identifier-naming)
+
+// --- Element access ---
+template <usize L, typename T> Vec<L, T> VecSoa<L, T>::Get(usize idx) const noexcept { assert(idx < size()); Vec<L, T> result; for (usize com = 0; com < L; ++com) result[com] = data_[com][idx]; return result; }
+template <usize L, typename T> void      VecSoa<L, T>::Set(usize idx, Vec<L, T> const& vec) noexcept { assert(idx < size()); for (usize com = 0; com < L; ++com) data_[com][idx] = vec[com]; }
+
+// --- Explicit basic constructors ---
+template <usize L, typename T> VecSoa<L, T>::VecSoa(usize size) { resize(size); }
+
+// --- Conversion constructors ---
+template <usize L, typename T> VecSoa<L, T>::VecSoa(std::span<Vec<L, T> const> vecs) { Load(vecs); }
+
+// --- Conversions ---
+template <usize L, typename T> void VecSoa<L, T>::Load(std::span<Vec<L, T> const> vecs) {
+  resize(vecs.size());
+  T* dst[L];
+  for (usize com = 0; com < L; ++com) dst[com] = data_[com].data();
+  usize idx = 0;
+#ifdef TRANSFORM_SIMD_SSE
+  if constexpr (std::is_same_v<T, f32> && (L == 3 || L == 4)) {
+    static_assert(sizeof(Vec<L, T>) == L * sizeof(T));
+    idx = vecs.size() & ~usize{3};
+    simd::Deinterleave<L>(reinterpret_cast<f32 const*>(vecs.data()), dst, idx);
+  }
+#endif
+  for (; idx < vecs.size(); ++idx)
+    for (usize com = 0; com < L; ++com) dst[com][idx] = vecs[idx][com];
+}
+template <usize L, typename T> void VecSoa<L, T>::Store(std::span<Vec<L, T>> vecs) const noexcept {
+  assert(vecs.size() == size());
+  T const* src[L];
+  for (usize com = 0; com < L; ++com) src[com] = data_[com].data();
+  usize idx = 0;
+#ifdef TRANSFORM_SIMD_SSE
+  if constexpr (std::is_same_v<T, f32> && (L == 3 || L == 4)) {
+    idx = vecs.size() & ~usize{3};
+    simd::Interleave<L>(src, reinterpret_cast<f32*>(vecs.data()), idx);
+  }
+#endif
+  for (; idx < vecs.size(); ++idx)
+    for (usize com = 0; com < L; ++com) vecs[idx][com] = src[com][idx];
+}
+
+// --- Unary arithmetic operators ---
+template <usize L, typename T> VecSoa<L, T>& VecSoa<L, T>::operator+=(T sca) noexcept { for (std::vector<T>& com : data_) simd::Lanes(com.size(), com.data(), [sca](auto lane) { return lane + sca; }, com.data()); return *this; }
+template <usize L, typename T> VecSoa<L, T>& VecSoa<L, T>::operator-=(T sca) noexcept { for (std::vector<T>& com : data_) simd::Lanes(com.size(), com.data(), [sca](auto lane) { return lane - sca; }, com.data()); return *this; }
+template <usize L, typename T> VecSoa<L, T>& VecSoa<L, T>::operator*=(T sca) noexcept { for (std::vector<T>& com : data_) simd::Lanes(com.size(), com.data(), [sca](auto lane) { return lane * sca; }, com.data()); return *this; }
+template <usize L, typename T> VecSoa<L, T>& VecSoa<L, T>::operator/=(T sca) noexcept { for (std::vector<T>& com : data_) simd::Lanes(com.size(), com.data(), [sca](auto lane) { return lane / sca; }, com.data()); return *this; }
+
+template <usize L, typename T> VecSoa<L, T>& VecSoa<L, T>::operator+=(Vec<L, T> const& vec) noexcept { for (usize com = 0; com < L; ++com) simd::Lanes(size(), data_[com].data(), [sca = vec[com]](auto lane) { return lane + sca; }, data_[com].data()); return *this; }
+template <usize L, typename T> VecSoa<L, T>& VecSoa<L, T>::operator-=(Vec<L, T> const& vec) noexcept { for (usize com = 0; com < L; ++com) simd::Lanes(size(), data_[com].data(), [sca = vec[com]](auto lane) { return lane - sca; }, data_[com].data()); return *this; }
+template <usize L, typename T> VecSoa<L, T>& VecSoa<L, T>::operator*=(Vec<L, T> const& vec) noexcept { for (usize com = 0; com < L; ++com) simd::Lanes(size(), data_[com].data(), [sca = vec[com]](auto lane) { return lane * sca; }, data_[com].data()); return *this; }
+template <usize L, typename T> VecSoa<L, T>& VecSoa<L, T>::operator/=(Vec<L, T> const& vec) noexcept { for (usize com = 0; com < L; ++com) simd::Lanes(size(), data_[com].data(), [sca = vec[com]](auto lane) { return lane / sca; }, data_[com].data()); return *this; }
+
+template <usize L, typename T> VecSoa<L, T>& VecSoa<L, T>::operator+=(VecSoa const& soa) noexcept { assert(soa.size() == size()); for (usize com = 0; com < L; ++com) simd::Lanes(size(), data_[com].data(), [](auto lhs, auto rhs) { return lhs + rhs; }, data_[com].data(), soa.data_[com].data()); return *this; }
+template <usize L, typename T> VecSoa<L, T>& VecSoa<L, T>::operator-=(VecSoa const& soa) noexcept { assert(soa.size() == size()); for (usize com = 0; com < L; ++com) simd::Lanes(size(), data_[com].data(), [](auto lhs, auto rhs) { return lhs - rhs; }, data_[com].data(), soa.data_[com].data()); return *this; }
+template <usize L, typename T> VecSoa<L, T>& VecSoa<L, T>::operator*=(VecSoa const& soa) noexcept { assert(soa.size() == size()); for (usize com = 0; com < L; ++com) simd::Lanes(size(), data_[com].data(), [](auto lhs, auto rhs) { return lhs * rhs; }, data_[com].data(), soa.data_[com].data()); return *this; }
+template <usize L, typename T> VecSoa<L, T>& VecSoa<L, T>::operator/=(VecSoa const& soa) noexcept { assert(soa.size() == size()); for (usize com = 0; com < L; ++com) simd::Lanes(size(), data_[com].data(), [](auto lhs, auto rhs) { return lhs / rhs; }, data_[com].data(), soa.data_[com].data()); return *this; }
+
+template <usize L, typename T> VecSoa<L, T>& VecSoa<L, T>::AddScaled(VecSoa const& soa, T sca) noexcept {
+  assert(soa.size() == size());
+  for (usize com = 0; com < L; ++com) simd::Lanes(size(), data_[com].data(), [sca](auto lhs, auto rhs) { return lhs + rhs * sca; }, data_[com].data(), soa.data_[com].data());
+  return *this;
+}
+
+// --- Unary arithmetic operators ---
+template <usize L, typename T> VecSoa<L, T> operator-(VecSoa<L, T> const& soa) { VecSoa<L, T> result(soa.size()); for (usize com = 0; com < L; ++com) simd::Lanes(soa.size(), result[com].data(), [](auto lane) { return -lane; }, soa[com].data()); return result; }
+
+// --- Binary arithmetic operators ---
+template <usize L, typename T> VecSoa<L, T> operator+(VecSoa<L, T> const& soa, T sca) { VecSoa<L, T> result(soa.size()); for (usize com = 0; com < L; ++com) simd::Lanes(soa.size(), result[com].data(), [sca](auto lane) { return lane + sca; }, soa[com].data()); return result; }
+template <usize L, typename T> VecSoa<L, T> operator-(VecSoa<L, T> const& soa, T sca) { VecSoa<L, T> result(soa.size()); for (usize com = 0; com < L; ++com) simd::Lanes(soa.size(), result[com].data(), [sca](auto lane) { return lane - sca; }, soa[com].data()); return result; }
+template <usize L, typename T> VecSoa<L, T> operator*(VecSoa<L, T> const& soa, T sca) { VecSoa<L, T> result(soa.size()); for (usize com = 0; com < L; ++com) simd::Lanes(soa.size(), result[com].data(), [sca](auto lane) { return lane * sca; }, soa[com].data()); return result; }
+template <usize L, typename T> VecSoa<L, T> operator/(VecSoa<L, T> const& soa, T sca) { VecSoa<L, T> result(soa.size()); for (usize com = 0; com < L; ++com) simd::Lanes(soa.size(), result[com].data(), [sca](auto lane) { return lane / sca; }, soa[com].data()); return result; }
+
+template <usize L, typename T> VecSoa<L, T> operator*(T sca, VecSoa<L, T> const& soa) { VecSoa<L, T> result(soa.size()); for (usize com = 0; com < L; ++com) simd::Lanes(soa.size(), result[com].data(), [sca](auto lane) { return sca * lane; }, soa[com].data()); return result; }
+
+template <usize L, typename T> VecSoa<L, T> operator+(VecSoa<L, T> const& soa1, VecSoa<L, T> const& soa2) { assert(soa1.size() == soa2.size()); VecSoa<L, T> result(soa1.size()); for (usize com = 0; com < L; ++com) simd::Lanes(soa1.size(), result[com].data(), [](auto lhs, auto rhs) { return lhs + rhs; }, soa1[com].data(), soa2[com].data()); return result; }
+template <usize L, typename T> VecSoa<L, T> operator-(VecSoa<L, T> const& soa1, VecSoa<L, T> const& soa2) { assert(soa1.size() == soa2.size()); VecSoa<L, T> result(soa1.size()); for (usize com = 0; com < L; ++com) simd::Lanes(soa1.size(), result[com].data(), [](auto lhs, auto rhs) { return lhs - rhs; }, soa1[com].data(), soa2[com].data()); return result; }
+template <usize L, typename T> VecSoa<L, T> operator*(VecSoa<L, T> const& soa1, VecSoa<L, T> const& soa2) { assert(soa1.size() == soa2.size()); VecSoa<L, T> result(soa1.size()); for (usize com = 0; com < L; ++com) simd::Lanes(soa1.size(), result[com].data(), [](auto lhs, auto rhs) { return lhs * rhs; }, soa1[com].data(), soa2[com].data()); return result; }
+template <usize L, typename T> VecSoa<L, T> operator/(VecSoa<L, T> const& soa1, VecSoa<L, T> const& soa2) { assert(soa1.size() == soa2.size()); VecSoa<L, T> result(soa1.size()); for (usize com = 0; com < L; ++com) simd::Lanes(soa1.size(), result[com].data(), [](auto lhs, auto rhs) { return lhs / rhs; }, soa1[com].data(), soa2[com].data()); return result; }
+
+// --- Functions ---
+// Dot keeps Sum's right fold: the last product first, then each earlier one added in front of the running sum.
+template <usize L, typename T> std::vector<T> Dot(VecSoa<L, T> const& soa1, VecSoa<L, T> const& soa2) {
+  assert(soa1.size() == soa2.size());
+  std::vector<T> result(soa1.size());
+  simd::Lanes(result.size(), result.data(), [](auto lhs, auto rhs) { return lhs * rhs; }, soa1[L - 1].data(), soa2[L - 1].data());
+  for (usize com = L - 1; com-- > 0;) simd::Lanes(result.size(), result.data(), [](auto lhs, auto rhs, auto sum) { return lhs * rhs + sum; }, soa1[com].data(), soa2[com].data(), result.data());
+  return result;
+}
+
+template <usize L, typename T> std::vector<T> Length(VecSoa<L, T> const& soa) {
+  std::vector<T> result = Dot(soa, soa);
+  simd::Lanes(result.size(), result.data(), [](auto dot) { using std::sqrt; return sqrt(dot); }, result.data());
+  return result;
+}
+
+template <typename T> VecSoa<3, T> Cross(VecSoa<3, T> const& soa1, VecSoa<3, T> const& soa2) {
+  assert(soa1.size() == soa2.size());
+  VecSoa<3, T> result(soa1.size());
+  auto const det2 = [](auto lhs1, auto rhs2, auto lhs2, auto rhs1) { return lhs1 * rhs2 - lhs2 * rhs1; };
+  simd::Lanes(result.size(), result[0].data(), det2, soa1[1].data(), soa2[2].data(), soa1[2].data(), soa2[1].data());
+  simd::Lanes(result.size(), result[1].data(), det2, soa1[2].data(), soa2[0].data(), soa1[0].data(), soa2[2].data());
+  simd::Lanes(result.size(), result[2].data(), det2, soa1[0].data(), soa2[1].data(), soa1[1].data(), soa2[0].data());
+  return result;
+}
+
+template <usize L, typename T> VecSoa<L, T> Normalize(VecSoa<L, T> const& soa) {
+  std::vector<T> const lengths = Length(soa);
+  VecSoa<L, T> result(soa.size());
+  for (usize com = 0; com < L; ++com) simd::Lanes(soa.size(), result[com].data(), [](auto lane, auto length) { return lane / length; }, soa[com].data(), lengths.data());
+  return result;
+}
+
+}  // namespace tf
+
+#undef TRANSFORM_IVDEP
+
+#endif  // TRANSFORM_VEC_SOA_H_
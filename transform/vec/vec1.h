@@ -2,6 +2,7 @@
 #define TRANSFORM_VEC_VEC1_H_
 
 #include <cassert>
+#include <type_traits>
 
 #include "transform/types.h"
 #include "transform/vec/vec.h"
@@ -11,7 +12,7 @@ namespace tf {
 template <typename T> class Vec<1, T> {
  private:
   // --- Data ---
-  T head_;
+  T data_[1];
 
  public:
   // --- Types ---
@@ -25,6 +26,9 @@ template <typename T> class Vec<1, T> {
   constexpr T &      operator[]([[maybe_unused]] LengthType idx)       noexcept;
   constexpr T const& operator[]([[maybe_unused]] LengthType idx) const noexcept;
 
+  constexpr T      * data()       noexcept;  // NOLINT(*-identifier-naming)
+  constexpr T const* data() const noexcept;  // NOLINT(*-identifier-naming)
+
   constexpr T const& head() const noexcept;  // NOLINT(*-identifier-naming)
 
   constexpr T const& x() const noexcept;  // NOLINT(*-identifier-naming)
@@ -39,7 +43,7 @@ template <typename T> class Vec<1, T> {
 
   // --- Implicit basic constructors ---
   constexpr Vec() noexcept;
-  constexpr Vec(Vec const& vec);
+  constexpr Vec(Vec const& vec)     = default;
   constexpr Vec(Vec&& vec) noexcept = default;
 
   // --- Explicit basic constructors ---
@@ -145,49 +149,74 @@ template <typename T> constexpr bool operator!=(Vec<1, T> const& vec1, Vec<1, T>
 constexpr Vec<1, bool> operator&&(Vec<1, bool> const& vec1, Vec<1, bool> const& vec2);
 constexpr Vec<1, bool> operator||(Vec<1, bool> const& vec1, Vec<1, bool> const& vec2);
 
+// --- Comparison operators ---
+template <typename T> constexpr Vec<1, bool> operator< (Vec<1, T> const& vec1, Vec<1, T> const& vec2);
+template <typename T> constexpr Vec<1, bool> operator<=(Vec<1, T> const& vec1, Vec<1, T> const& vec2);
+template <typename T> constexpr Vec<1, bool> operator> (Vec<1, T> const& vec1, Vec<1, T> const& vec2);
+template <typename T> constexpr Vec<1, bool> operator>=(Vec<1, T> const& vec1, Vec<1, T> const& vec2);
+
+template <typename T> constexpr Vec<1, bool> operator< (Vec<1, T> const& vec, T sca);
+template <typename T> constexpr Vec<1, bool> operator<=(Vec<1, T> const& vec, T sca);
+template <typename T> constexpr Vec<1, bool> operator> (Vec<1, T> const& vec, T sca);
+template <typename T> constexpr Vec<1, bool> operator>=(Vec<1, T> const& vec, T sca);
+
+template <typename T> constexpr Vec<1, bool> operator< (T sca, Vec<1, T> const& vec);
+template <typename T> constexpr Vec<1, bool> operator<=(T sca, Vec<1, T> const& vec);
+template <typename T> constexpr Vec<1, bool> operator> (T sca, Vec<1, T> const& vec);
+template <typename T> constexpr Vec<1, bool> operator>=(T sca, Vec<1, T> const& vec);
+
+constexpr Vec<1, bool> operator!(Vec<1, bool> const& vec);
+
 // --- Alias ---
 template <typename T> using Vec1 = Vec<1, T>;
 
+// --- Layout ---
+static_assert(std::is_trivially_copyable_v<Vec<1, f32>> && std::is_standard_layout_v<Vec<1, f32>>);
+static_assert(std::is_trivially_copyable_v<Vec<1, f64>> && std::is_standard_layout_v<Vec<1, f64>>);
+static_assert(std::is_trivially_copyable_v<Vec<1, i32>> && std::is_standard_layout_v<Vec<1, i32>>);
+
 /************************
  * Function definitions *
  ************************/
 
 // --- Component access ---
-template <typename T> constexpr T &      Vec<1, T>::operator[]([[maybe_unused]] LengthType idx)       noexcept { assert(idx < this->Length()); return this->head_; }
-template <typename T> constexpr T const& Vec<1, T>::operator[]([[maybe_unused]] LengthType idx) const noexcept { assert(idx < this->Length()); return this->head_; }
+template <typename T> constexpr T &      Vec<1, T>::operator[]([[maybe_unused]] LengthType idx)       noexcept { assert(idx < this->Length()); return this->data_[0]; }
+template <typename T> constexpr T const& Vec<1, T>::operator[]([[maybe_unused]] LengthType idx) const noexcept { assert(idx < this->Length()); return this->data_[0]; }
 
-template <typename T> constexpr T const& Vec<1, T>::head() const noexcept { return this->head_; };  // NOLINT(*-identifier-naming)
+template <typename T> constexpr T      * Vec<1, T>::data()       noexcept { return this->data_; }  // NOLINT(*-identifier-naming)
+template <typename T> constexpr T const* Vec<1, T>::data() const noexcept { return this->data_; }  // NOLINT(*-identifier-naming)
+
+template <typename T> constexpr T const& Vec<1, T>::head() const noexcept { return this->data_[0]; };  // NOLINT(*-identifier-naming)
 
 template <typename T> constexpr T const& Vec<1, T>::x() const noexcept { return this->head(); }  // NOLINT(*-identifier-naming)
 template <typename T> constexpr T const& Vec<1, T>::r() const noexcept { return this->head(); }  // NOLINT(*-identifier-naming)
 template <typename T> constexpr T const& Vec<1, T>::s() const noexcept { return this->head(); }  // NOLINT(*-identifier-naming)
 
-template <typename T> constexpr void Vec<1, T>::set_head(T head) noexcept { this->head_ = head; }  // NOLINT(*-identifier-naming)
+template <typename T> constexpr void Vec<1, T>::set_head(T head) noexcept { this->data_[0] = head; }  // NOLINT(*-identifier-naming)
 
 template <typename T> constexpr void Vec<1, T>::set_x(T sca) noexcept { this->set_head(sca); }  // NOLINT(*-identifier-naming)
 template <typename T> constexpr void Vec<1, T>::set_r(T sca) noexcept { this->set_head(sca); }  // NOLINT(*-identifier-naming)
 template <typename T> constexpr void Vec<1, T>::set_s(T sca) noexcept { this->set_head(sca); }  // NOLINT(*-identifier-naming)
 
 // --- Implicit basic constructors ---
-template <typename T> constexpr Vec<1, T>::Vec() noexcept : head_() {}
-template <typename T> constexpr Vec<1, T>::Vec(Vec const& vec) : head_(vec.head_) {}
+template <typename T> constexpr Vec<1, T>::Vec() noexcept : data_() {}
 
 // --- Explicit basic constructors ---
-template <typename T> constexpr Vec<1, T>::Vec(T sca) noexcept : head_(sca) {}
+template <typename T> constexpr Vec<1, T>::Vec(T sca) noexcept : data_{sca} {}
 
 // --- Conversion constructors ---
-template <typename T> template <typename A> constexpr Vec<1, T>::Vec(A head) noexcept : head_(static_cast<T>(head)) {}
+template <typename T> template <typename A> constexpr Vec<1, T>::Vec(A head) noexcept : data_{static_cast<T>(head)} {}
 
-template <typename T> template <usize M, typename A> constexpr Vec<1, T>::Vec(Vec<M, A> const& vec) noexcept : head_(static_cast<T>(vec.head())) {}
+template <typename T> template <usize M, typename A> constexpr Vec<1, T>::Vec(Vec<M, A> const& vec) noexcept : data_{static_cast<T>(vec.head())} {}
 
 // --- Unary arithmetic operators ---
-template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator=(Vec<1, U> const& vec) { this->head_ = static_cast<T>(vec.head()); return *this; }
+template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator=(Vec<1, U> const& vec) { this->data_[0] = static_cast<T>(vec.head()); return *this; }
 
-template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator+=(U sca) { this->head_ += static_cast<T>(sca); return *this; }
-template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator-=(U sca) { this->head_ -= static_cast<T>(sca); return *this; }
-template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator*=(U sca) { this->head_ *= static_cast<T>(sca); return *this; }
-template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator/=(U sca) { this->head_ /= static_cast<T>(sca); return *this; }
-template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator%=(U sca) { this->head_ %= static_cast<T>(sca); return *this; }
+template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator+=(U sca) { this->data_[0] += static_cast<T>(sca); return *this; }
+template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator-=(U sca) { this->data_[0] -= static_cast<T>(sca); return *this; }
+template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator*=(U sca) { this->data_[0] *= static_cast<T>(sca); return *this; }
+template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator/=(U sca) { this->data_[0] /= static_cast<T>(sca); return *this; }
+template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator%=(U sca) { this->data_[0] %= static_cast<T>(sca); return *this; }
 
 template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator+=(Vec<1, U> const& vec) { return *this += vec.head(); }
 template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator-=(Vec<1, U> const& vec) { return *this -= vec.head(); }
@@ -195,18 +224,18 @@ template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::oper
 template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator/=(Vec<1, U> const& vec) { return *this /= vec.head(); }
 template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator%=(Vec<1, U> const& vec) { return *this %= vec.head(); }
 
-template <typename T> constexpr Vec<1, T>& Vec<1, T>::operator++() { ++this->head_; return *this; }
-template <typename T> constexpr Vec<1, T>& Vec<1, T>::operator--() { --this->head_; return *this; }
+template <typename T> constexpr Vec<1, T>& Vec<1, T>::operator++() { ++this->data_[0]; return *this; }
+template <typename T> constexpr Vec<1, T>& Vec<1, T>::operator--() { --this->data_[0]; return *this; }
 
 template <typename T> constexpr Vec<1, T> Vec<1, T>::operator++(int) { Vec<1, T> result(*this); ++(*this); return result; }
 template <typename T> constexpr Vec<1, T> Vec<1, T>::operator--(int) { Vec<1, T> result(*this); --(*this); return result; }
 
 // --- Unary bit operators ---
-template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator&= (U sca) { this->head_ &=  static_cast<T>(sca); return *this; }
-template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator|= (U sca) { this->head_ |=  static_cast<T>(sca); return *this; }
-template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator^= (U sca) { this->head_ ^=  static_cast<T>(sca); return *this; }
-template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator<<=(U sca) { this->head_ <<= static_cast<T>(sca); return *this; }
-template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator>>=(U sca) { this->head_ >>= static_cast<T>(sca); return *this; }
+template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator&= (U sca) { this->data_[0] &=  static_cast<T>(sca); return *this; }
+template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator|= (U sca) { this->data_[0] |=  static_cast<T>(sca); return *this; }
+template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator^= (U sca) { this->data_[0] ^=  static_cast<T>(sca); return *this; }
+template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator<<=(U sca) { this->data_[0] <<= static_cast<T>(sca); return *this; }
+template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator>>=(U sca) { this->data_[0] >>= static_cast<T>(sca); return *this; }
 
 template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator&= (Vec<1, U> const& vec) { return *this&=  vec.head(); }
 template <typename T> template <typename U> constexpr Vec<1, T>& Vec<1, T>::operator|= (Vec<1, U> const& vec) { return *this|=  vec.head(); }
@@ -266,6 +295,24 @@ template <typename T> constexpr bool operator!=(Vec<1, T> const& vec1, Vec<1, T>
 constexpr Vec<1, bool> operator&&(Vec<1, bool> const& vec1, Vec<1, bool> const& vec2) { return Vec<1, bool>(vec1.head() && vec2.head()); }
 constexpr Vec<1, bool> operator||(Vec<1, bool> const& vec1, Vec<1, bool> const& vec2) { return Vec<1, bool>(vec1.head() || vec2.head()); }
 
+// --- Comparison operators ---
+template <typename T> constexpr Vec<1, bool> operator< (Vec<1, T> const& vec1, Vec<1, T> const& vec2) { return Vec<1, bool>(vec1.head() <  vec2.head()); }
+template <typename T> constexpr Vec<1, bool> operator<=(Vec<1, T> const& vec1, Vec<1, T> const& vec2) { return Vec<1, bool>(vec1.head() <= vec2.head()); }
+template <typename T> constexpr Vec<1, bool> operator> (Vec<1, T> const& vec1, Vec<1, T> const& vec2) { return Vec<1, bool>(vec1.head() >  vec2.head()); }
+template <typename T> constexpr Vec<1, bool> operator>=(Vec<1, T> const& vec1, Vec<1, T> const& vec2) { return Vec<1, bool>(vec1.head() >= vec2.head()); }
+
+template <typename T> constexpr Vec<1, bool> operator< (Vec<1, T> const& vec, T sca) { return Vec<1, bool>(vec.head() <  sca); }
+template <typename T> constexpr Vec<1, bool> operator<=(Vec<1, T> const& vec, T sca) { return Vec<1, bool>(vec.head() <= sca); }
+template <typename T> constexpr Vec<1, bool> operator> (Vec<1, T> const& vec, T sca) { return Vec<1, bool>(vec.head() >  sca); }
+template <typename T> constexpr Vec<1, bool> operator>=(Vec<1, T> const& vec, T sca) { return Vec<1, bool>(vec.head() >= sca); }
+
+template <typename T> constexpr Vec<1, bool> operator< (T sca, Vec<1, T> const& vec) { return Vec<1, bool>(sca <  vec.head()); }
+template <typename T> constexpr Vec<1, bool> operator<=(T sca, Vec<1, T> const& vec) { return Vec<1, bool>(sca <= vec.head()); }
+template <typename T> constexpr Vec<1, bool> operator> (T sca, Vec<1, T> const& vec) { return Vec<1, bool>(sca >  vec.head()); }
+template <typename T> constexpr Vec<1, bool> operator>=(T sca, Vec<1, T> const& vec) { return Vec<1, bool>(sca >= vec.head()); }
+
+constexpr Vec<1, bool> operator!(Vec<1, bool> const& vec) { return Vec<1, bool>(!vec.head()); }
+
 }  // namespace tf
 
 #endif  // TRANSFORM_VEC_VEC1_H_
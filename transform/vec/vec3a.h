@@ -0,0 +1,217 @@
+#ifndef TRANSFORM_VEC_VEC3A_H_
+#define TRANSFORM_VEC_VEC3A_H_
+
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+#include "transform/types.h"
+#include "transform/mat/mat.h"
+#include "transform/vec/func.h"
+#include "transform/vec/vec3.h"
+#include "transform/vec/vec4.h"
+
+namespace tf {
+
+// Three component vector padded to four lanes. Element-wise arithmetic runs over all four lanes, so with the SIMD
+// backend (`transform/simd/vec3a.h`) each f32 operation is a single 128-bit instruction, and Cross, Dot, Normalize and
+// Mat4 * Vec3A stay in one register. The w lane is padding: it starts at zero and comparisons and reductions ignore
+// it. Division by a vector skips w so that integer vectors never divide by the zero padding.
+template <typename T> class alignas(4 * sizeof(T)) Vec3A {
+ private:
+  // --- Data ---
+  T data_[4];
+
+ public:
+  // --- Types ---
+  using ValueType  = T;
+  using Type       = Vec3A<T>;
+  using LengthType = usize;
+
+  // --- Component access ---
+  static constexpr LengthType Length() noexcept { return 3; }
+
+  constexpr T &      operator[](LengthType idx)       noexcept;
+  constexpr T const& operator[](LengthType idx) const noexcept;
+
+  constexpr T      * data()       noexcept;  // NOLINT(*-identifier-naming)
+  constexpr T const* data() const noexcept;  // NOLINT(*-identifier-naming)
+
+  constexpr T const& x() const noexcept;  // NOLINT(*-identifier-naming)
+  constexpr T const& y() const noexcept;  // NOLINT(*-identifier-naming)
+  constexpr T const& z() const noexcept;  // NOLINT(*-identifier-naming)
+
+  constexpr Vec<3, T> xyz() const noexcept;  // NOLINT(*-identifier-naming)
+
+  constexpr void set_x(T sca) noexcept;  // NOLINT(*-identifier-naming)
+  constexpr void set_y(T sca) noexcept;  // NOLINT(*-identifier-naming)
+  constexpr void set_z(T sca) noexcept;  // NOLINT(*-identifier-naming)
+
+  // --- Implicit basic constructors ---
+  constexpr Vec3A() noexcept;
+  constexpr Vec3A(Vec3A const& vec)     = default;
+  constexpr Vec3A(Vec3A&& vec) noexcept = default;
+
+  // --- Explicit basic constructors ---
+  explicit constexpr Vec3A(T vecx, T vecy, T vecz) noexcept;
+
+  // --- Conversion constructors ---
+  explicit constexpr Vec3A(Vec<3, T> const& vec) noexcept;
+
+  // --- Destructor ---
+  inline ~Vec3A() noexcept = default;
+
+  // --- Factory ---
+  static constexpr Vec3A<T> Fill(T sca) noexcept { return Vec3A<T>(sca, sca, sca); }
+
+  // --- Unary arithmetic operators ---
+  constexpr Vec3A<T>& operator=(Vec3A const& vec)     = default;
+  constexpr Vec3A<T>& operator=(Vec3A&& vec) noexcept = default;
+
+  constexpr Vec3A<T>& operator+=(T sca);
+  constexpr Vec3A<T>& operator-=(T sca);
+  constexpr Vec3A<T>& operator*=(T sca);
+  constexpr Vec3A<T>& operator/=(T sca);
+
+  constexpr Vec3A<T>& operator+=(Vec3A<T> const& vec);
+  constexpr Vec3A<T>& operator-=(Vec3A<T> const& vec);
+  constexpr Vec3A<T>& operator*=(Vec3A<T> const& vec);
+  constexpr Vec3A<T>& operator/=(Vec3A<T> const& vec);
+};
+
+// --- Unary arithmetic operators ---
+template <typename T> constexpr Vec3A<T> operator+(Vec3A<T> const& vec);
+template <typename T> constexpr Vec3A<T> operator-(Vec3A<T> const& vec);
+
+// --- Binary arithmetic operators ---
+template <typename T> constexpr Vec3A<T> operator+(Vec3A<T> const& vec1, T sca2);
+template <typename T> constexpr Vec3A<T> operator-(Vec3A<T> const& vec1, T sca2);
+template <typename T> constexpr Vec3A<T> operator*(Vec3A<T> const& vec1, T sca2);
+template <typename T> constexpr Vec3A<T> operator/(Vec3A<T> const& vec1, T sca2);
+
+template <typename T> constexpr Vec3A<T> operator+(T sca1, Vec3A<T> const& vec2);
+template <typename T> constexpr Vec3A<T> operator-(T sca1, Vec3A<T> const& vec2);
+template <typename T> constexpr Vec3A<T> operator*(T sca1, Vec3A<T> const& vec2);
+template <typename T> constexpr Vec3A<T> operator/(T sca1, Vec3A<T> const& vec2);
+
+template <typename T> constexpr Vec3A<T> operator+(Vec3A<T> const& vec1, Vec3A<T> const& vec2);
+template <typename T> constexpr Vec3A<T> operator-(Vec3A<T> const& vec1, Vec3A<T> const& vec2);
+template <typename T> constexpr Vec3A<T> operator*(Vec3A<T> const& vec1, Vec3A<T> const& vec2);
+template <typename T> constexpr Vec3A<T> operator/(Vec3A<T> const& vec1, Vec3A<T> const& vec2);
+
+template <typename T> constexpr Vec3A<T> operator*(Mat<4, 4, T> const& mat1, Vec3A<T> const& vec2);
+
+// --- Boolean operators ---
+template <typename T> constexpr bool operator==(Vec3A<T> const& vec1, Vec3A<T> const& vec2);
+template <typename T> constexpr bool operator!=(Vec3A<T> const& vec1, Vec3A<T> const& vec2);
+
+// --- Functions ---
+template <typename T> constexpr        T  Length   (Vec3A<T> const& vec);
+template <typename T> constexpr Vec3A<T> Normalize(Vec3A<T> const& vec);
+
+template <typename T> constexpr Vec3A<T> Cross   (Vec3A<T> const& vec1, Vec3A<T> const& vec2);
+template <typename T> constexpr        T  Dot     (Vec3A<T> const& vec1, Vec3A<T> const& vec2);
+template <typename T> constexpr        T  Distance(Vec3A<T> const& vec1, Vec3A<T> const& vec2);
+
+// The precision policies of `transform/vec/func.h`. The constraint keeps `Length<f32>(vec)` on the overloads above.
+
+template <typename P, typename T> requires kIsPolicy<P> constexpr        T  Length   (Vec3A<T> const& vec);
+template <typename P, typename T> requires kIsPolicy<P> constexpr Vec3A<T> Normalize(Vec3A<T> const& vec);
+
+// --- Layout ---
+static_assert(sizeof(Vec3A<f32>) == 16 && alignof(Vec3A<f32>) == 16);
+static_assert(sizeof(Vec3A<f64>) == 32 && alignof(Vec3A<f64>) == 32);
+static_assert(std::is_trivially_copyable_v<Vec3A<f32>> && std::is_standard_layout_v<Vec3A<f32>>);
+
+/************************
+ * Function definitions *
+ ************************/
+
+// --- Component access ---
+template <typename T> constexpr T &      Vec3A<T>::operator[](LengthType idx)       noexcept { assert(idx < this->Length()); return this->data_[idx]; }
+template <typename T> constexpr T const& Vec3A<T>::operator[](LengthType idx) const noexcept { assert(idx < this->Length()); return this->data_[idx]; }
+
+template <typename T> constexpr T      * Vec3A<T>::data()       noexcept { return this->data_; }  // NOLINT(*-identifier-naming)
+template <typename T> constexpr T const* Vec3A<T>::data() const noexcept { return this->data_; }  // NOLINT(*-identifier-naming)
+
+template <typename T> constexpr T const& Vec3A<T>::x() const noexcept { return this->data_[0]; }  // NOLINT(*-identifier-naming)
+template <typename T> constexpr T const& Vec3A<T>::y() const noexcept { return this->data_[1]; }  // NOLINT(*-identifier-naming)
+template <typename T> constexpr T const& Vec3A<T>::z() const noexcept { return this->data_[2]; }  // NOLINT(*-identifier-naming)
+
+template <typename T> constexpr Vec<3, T> Vec3A<T>::xyz() const noexcept { return Vec<3, T>(this->data_[0], this->data_[1], this->data_[2]); }  // NOLINT(*-identifier-naming)
+
+template <typename T> constexpr void Vec3A<T>::set_x(T sca) noexcept { this->data_[0] = sca; }  // NOLINT(*-identifier-naming)
+template <typename T> constexpr void Vec3A<T>::set_y(T sca) noexcept { this->data_[1] = sca; }  // NOLINT(*-identifier-naming)
+template <typename T> constexpr void Vec3A<T>::set_z(T sca) noexcept { this->data_[2] = sca; }  // NOLINT(*-identifier-naming)
+
+// --- Implicit basic constructors ---
+template <typename T> constexpr Vec3A<T>::Vec3A() noexcept : data_() {}
+
+// --- Explicit basic constructors ---
+template <typename T> constexpr Vec3A<T>::Vec3A(T vecx, T vecy, T vecz) noexcept : data_{vecx, vecy, vecz, T()} {}
+
+// --- Conversion constructors ---
+template <typename T> constexpr Vec3A<T>::Vec3A(Vec<3, T> const& vec) noexcept : data_{vec[0], vec[1], vec[2], T()} {}
+
+// --- Unary arithmetic operators ---
+template <typename T> constexpr Vec3A<T>& Vec3A<T>::operator+=(T sca) { for (LengthType idx = 0; idx < 4; ++idx) this->data_[idx] += sca; return *this; }
+template <typename T> constexpr Vec3A<T>& Vec3A<T>::operator-=(T sca) { for (LengthType idx = 0; idx < 4; ++idx) this->data_[idx] -= sca; return *this; }
+template <typename T> constexpr Vec3A<T>& Vec3A<T>::operator*=(T sca) { for (LengthType idx = 0; idx < 4; ++idx) this->data_[idx] *= sca; return *this; }
+template <typename T> constexpr Vec3A<T>& Vec3A<T>::operator/=(T sca) { for (LengthType idx = 0; idx < 4; ++idx) this->data_[idx] /= sca; return *this; }
+
+template <typename T> constexpr Vec3A<T>& Vec3A<T>::operator+=(Vec3A<T> const& vec) { for (LengthType idx = 0; idx < 4; ++idx) this->data_[idx] += vec.data_[idx]; return *this; }
+template <typename T> constexpr Vec3A<T>& Vec3A<T>::operator-=(Vec3A<T> const& vec) { for (LengthType idx = 0; idx < 4; ++idx) this->data_[idx] -= vec.data_[idx]; return *this; }
+template <typename T> constexpr Vec3A<T>& Vec3A<T>::operator*=(Vec3A<T> const& vec) { for (LengthType idx = 0; idx < 4; ++idx) this->data_[idx] *= vec.data_[idx]; return *this; }
+template <typename T> constexpr Vec3A<T>& Vec3A<T>::operator/=(Vec3A<T> const& vec) { for (LengthType idx = 0; idx < 3; ++idx) this->data_[idx] /= vec.data_[idx]; return *this; }
+
+// --- Unary arithmetic operators ---
+template <typename T> constexpr Vec3A<T> operator+(Vec3A<T> const& vec) { return vec; }
+template <typename T> constexpr Vec3A<T> operator-(Vec3A<T> const& vec) { Vec3A<T> result; for (usize idx = 0; idx < 4; ++idx) result.data()[idx] = static_cast<T>(-vec.data()[idx]); return result; }
+
+// --- Binary arithmetic operators ---
+template <typename T> constexpr Vec3A<T> operator+(Vec3A<T> const& vec1, T sca2) { Vec3A<T> result(vec1); return result += sca2; }
+template <typename T> constexpr Vec3A<T> operator-(Vec3A<T> const& vec1, T sca2) { Vec3A<T> result(vec1); return result -= sca2; }
+template <typename T> constexpr Vec3A<T> operator*(Vec3A<T> const& vec1, T sca2) { Vec3A<T> result(vec1); return result *= sca2; }
+template <typename T> constexpr Vec3A<T> operator/(Vec3A<T> const& vec1, T sca2) { Vec3A<T> result(vec1); return result /= sca2; }
+
+template <typename T> constexpr Vec3A<T> operator+(T sca1, Vec3A<T> const& vec2) { return Vec3A<T>::Fill(sca1) + vec2; }
+template <typename T> constexpr Vec3A<T> operator-(T sca1, Vec3A<T> const& vec2) { return Vec3A<T>::Fill(sca1) - vec2; }
+template <typename T> constexpr Vec3A<T> operator*(T sca1, Vec3A<T> const& vec2) { return Vec3A<T>::Fill(sca1) * vec2; }
+template <typename T> constexpr Vec3A<T> operator/(T sca1, Vec3A<T> const& vec2) { return Vec3A<T>::Fill(sca1) / vec2; }
+
+template <typename T> constexpr Vec3A<T> operator+(Vec3A<T> const& vec1, Vec3A<T> const& vec2) { Vec3A<T> result(vec1); return result += vec2; }
+template <typename T> constexpr Vec3A<T> operator-(Vec3A<T> const& vec1, Vec3A<T> const& vec2) { Vec3A<T> result(vec1); return result -= vec2; }
+template <typename T> constexpr Vec3A<T> operator*(Vec3A<T> const& vec1, Vec3A<T> const& vec2) { Vec3A<T> result(vec1); return result *= vec2; }
+template <typename T> constexpr Vec3A<T> operator/(Vec3A<T> const& vec1, Vec3A<T> const& vec2) { Vec3A<T> result(vec1); return result /= vec2; }
+
+// Transforms the vector as a point (w = 1) and drops the projective w of the result.
+template <typename T> constexpr Vec3A<T> operator*(Mat<4, 4, T> const& mat1, Vec3A<T> const& vec2) { Vec3A<T> result; for (usize idx = 0; idx < 3; ++idx) result[idx] = mat1[0][idx] * vec2.x() + (mat1[1][idx] * vec2.y() + (mat1[2][idx] * vec2.z() + mat1[3][idx])); return result; }
+
+// --- Boolean operators ---
+template <typename T> constexpr bool operator==(Vec3A<T> const& vec1, Vec3A<T> const& vec2) { return vec1.x() == vec2.x() && vec1.y() == vec2.y() && vec1.z() == vec2.z(); }
+template <typename T> constexpr bool operator!=(Vec3A<T> const& vec1, Vec3A<T> const& vec2) { return !(vec1 == vec2); }
+
+// --- Functions ---
+template <typename T> constexpr        T  Length   (Vec3A<T> const& vec) { return static_cast<T>(std::sqrt(Dot(vec, vec))); }
+template <typename T> constexpr Vec3A<T> Normalize(Vec3A<T> const& vec) { return vec / Length(vec); }
+
+template <typename T> constexpr Vec3A<T> Cross   (Vec3A<T> const& vec1, Vec3A<T> const& vec2) { return Vec3A<T>(vec1.y() * vec2.z() - vec1.z() * vec2.y(), vec1.z() * vec2.x() - vec1.x() * vec2.z(), vec1.x() * vec2.y() - vec1.y() * vec2.x()); }
+template <typename T> constexpr        T  Dot     (Vec3A<T> const& vec1, Vec3A<T> const& vec2) { return vec1.x() * vec2.x() + (vec1.y() * vec2.y() + vec1.z() * vec2.z()); }
+template <typename T> constexpr        T  Distance(Vec3A<T> const& vec1, Vec3A<T> const& vec2) { return Length(vec2 - vec1); }
+
+template <typename P, typename T> requires kIsPolicy<P> constexpr T Length(Vec3A<T> const& vec) { return Length(vec); }
+template <typename P, typename T> requires kIsPolicy<P> constexpr Vec3A<T> Normalize(Vec3A<T> const& vec) {
+  if constexpr (std::is_same_v<P, Fast>) {
+    static_assert(std::is_floating_point_v<T>);
+    return vec * (static_cast<T>(1) / Length(vec));
+  }
+  return Normalize(vec);
+}
+
+}  // namespace tf
+
+#ifdef TRANSFORM_SIMD
+#include "transform/simd/vec3a.h"
+#endif
+
+#endif  // TRANSFORM_VEC_VEC3A_H_
@@ -2,6 +2,7 @@
 #define TRANSFORM_VEC_VECN_H_
 
 #include <cassert>
+#include <type_traits>
 
 #include "transform/types.h"
 #include "transform/vec/vec4.h"
@@ -11,8 +12,11 @@ namespace tf {
 template <usize L, typename T> class Vec {
  private:
   // --- Data ---
-  T head_;
-  Vec<L - 1, T> tail_;
+  T data_[L];
+
+  // --- Helpers ---
+  template          <typename A> constexpr usize Insert(usize idx,        A         sca) noexcept;
+  template <usize M, typename A> constexpr usize Insert(usize idx, Vec<M, A> const& vec) noexcept;
 
  public:
   // --- Types ---
@@ -26,24 +30,25 @@ template <usize L, typename T> class Vec {
   constexpr T &      operator[](LengthType idx)       noexcept;
   constexpr T const& operator[](LengthType idx) const noexcept;
 
-  constexpr T const& head() const noexcept;              // NOLINT(*-identifier-naming)
-  constexpr Vec<L - 1, T> const& tail() const noexcept;  // NOLINT(*-identifier-naming)
+  constexpr T      * data()       noexcept;  // NOLINT(*-identifier-naming)
+  constexpr T const* data() const noexcept;  // NOLINT(*-identifier-naming)
+
+  constexpr            T  const& head() const noexcept;  // NOLINT(*-identifier-naming)
+  constexpr Vec<L - 1, T>        tail() const noexcept;  // NOLINT(*-identifier-naming)
 
   constexpr void set_head(T head) noexcept;                     // NOLINT(*-identifier-naming)
   constexpr void set_tail(Vec<L - 1, T> const& tail) noexcept;  // NOLINT(*-identifier-naming)
 
   // --- Implicit basic constructors ---
   constexpr Vec() noexcept;
-  constexpr Vec(Vec const& vec);
+  constexpr Vec(Vec const& vec)     = default;
   constexpr Vec(Vec&& vec) noexcept = default;
 
   // --- Explicit basic constructors ---
   explicit constexpr Vec(T sca) noexcept;
 
   // --- Conversion constructors ---
-  template          <typename A, typename... B> explicit constexpr Vec(       A         head, B... tail) noexcept;
-  template          <typename A, typename... B> explicit constexpr Vec(Vec<1, A> const& head, B... tail) noexcept;
-  template <usize M, typename A, typename... B> explicit constexpr Vec(Vec<M, A> const& head, B... tail) noexcept;
+  template <typename A, typename... B> explicit constexpr Vec(A const& head, B const&... tail) noexcept;
 
   // --- Destructor ---
   inline ~Vec() noexcept = default;
@@ -176,40 +181,67 @@ template <usize L, typename T> constexpr bool operator!=(Vec<L, T> const& vec1,
 template <usize L> constexpr Vec<L, bool> operator&&(Vec<L, bool> const& vec1, Vec<L, bool> const& vec2);
 template <usize L> constexpr Vec<L, bool> operator||(Vec<L, bool> const& vec1, Vec<L, bool> const& vec2);
 
+// --- Comparison operators ---
+template <usize L, typename T> constexpr Vec<L, bool> operator< (Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+template <usize L, typename T> constexpr Vec<L, bool> operator<=(Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+template <usize L, typename T> constexpr Vec<L, bool> operator> (Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+template <usize L, typename T> constexpr Vec<L, bool> operator>=(Vec<L, T> const& vec1, Vec<L, T> const& vec2);
+
+template <usize L, typename T> constexpr Vec<L, bool> operator< (Vec<L, T> const& vec, T sca);
+template <usize L, typename T> constexpr Vec<L, bool> operator<=(Vec<L, T> const& vec, T sca);
+template <usize L, typename T> constexpr Vec<L, bool> operator> (Vec<L, T> const& vec, T sca);
+template <usize L, typename T> constexpr Vec<L, bool> operator>=(Vec<L, T> const& vec, T sca);
+
+template <usize L, typename T> constexpr Vec<L, bool> operator< (T sca, Vec<L, T> const& vec);
+template <usize L, typename T> constexpr Vec<L, bool> operator<=(T sca, Vec<L, T> const& vec);
+template <usize L, typename T> constexpr Vec<L, bool> operator> (T sca, Vec<L, T> const& vec);
+template <usize L, typename T> constexpr Vec<L, bool> operator>=(T sca, Vec<L, T> const& vec);
+
+template <usize L> constexpr Vec<L, bool> operator!(Vec<L, bool> const& vec);
+
+// --- Layout ---
+static_assert(std::is_trivially_copyable_v<Vec<5, f32>> && std::is_standard_layout_v<Vec<5, f32>>);
+static_assert(std::is_trivially_copyable_v<Vec<5, f64>> && std::is_standard_layout_v<Vec<5, f64>>);
+static_assert(std::is_trivially_copyable_v<Vec<5, i32>> && std::is_standard_layout_v<Vec<5, i32>>);
+
 /************************
  * Function definitions *
  ************************/
 
 // --- Component access ---
-template <usize L, typename T> constexpr T &      Vec<L, T>::operator[](LengthType idx)       noexcept { assert(idx < this->Length()); return idx == 0 ? this->head_ : this->tail_[idx - 1]; }
-template <usize L, typename T> constexpr T const& Vec<L, T>::operator[](LengthType idx) const noexcept { assert(idx < this->Length()); return idx == 0 ? this->head_ : this->tail_[idx - 1]; }
+template <usize L, typename T> constexpr T &      Vec<L, T>::operator[](LengthType idx)       noexcept { assert(idx < this->Length()); return this->data_[idx]; }
+template <usize L, typename T> constexpr T const& Vec<L, T>::operator[](LengthType idx) const noexcept { assert(idx < this->Length()); return this->data_[idx]; }
 
-template <usize L, typename T> constexpr            T  const& Vec<L, T>::head() const noexcept { return this->head_; }  // NOLINT(*-identifier-naming)
-template <usize L, typename T> constexpr Vec<L - 1, T> const& Vec<L, T>::tail() const noexcept { return this->tail_; }  // NOLINT(*-identifier-naming)
+template <usize L, typename T> constexpr T      * Vec<L, T>::data()       noexcept { return this->data_; }  // NOLINT(*-identifier-naming)
+template <usize L, typename T> constexpr T const* Vec<L, T>::data() const noexcept { return this->data_; }  // NOLINT(*-identifier-naming)
 
-template <usize L, typename T> constexpr void Vec<L, T>::set_head(T head)                    noexcept { this->head_ = head; };  // NOLINT(*-identifier-naming)
-template <usize L, typename T> constexpr void Vec<L, T>::set_tail(Vec<L - 1, T> const& tail) noexcept { this->tail_ = tail; };  // NOLINT(*-identifier-naming)
+template <usize L, typename T> constexpr            T  const& Vec<L, T>::head() const noexcept { return this->data_[0]; }  // NOLINT(*-identifier-naming)
+template <usize L, typename T> constexpr Vec<L - 1, T>        Vec<L, T>::tail() const noexcept { Vec<L - 1, T> result; for (LengthType idx = 1; idx < L; ++idx) result[idx - 1] = this->data_[idx]; return result; }  // NOLINT(*-identifier-naming)
+
+template <usize L, typename T> constexpr void Vec<L, T>::set_head(T head)                    noexcept { this->data_[0] = head; }  // NOLINT(*-identifier-naming)
+template <usize L, typename T> constexpr void Vec<L, T>::set_tail(Vec<L - 1, T> const& tail) noexcept { for (LengthType idx = 1; idx < L; ++idx) this->data_[idx] = tail[idx - 1]; }  // NOLINT(*-identifier-naming)
 
 // --- Implicit basic constructors ---
-template <usize L, typename T> constexpr Vec<L, T>::Vec() noexcept : head_(), tail_() {}
-template <usize L, typename T> constexpr Vec<L, T>::Vec(Vec const& vec) : head_(vec.head()), tail_(vec.tail()) {}
+template <usize L, typename T> constexpr Vec<L, T>::Vec() noexcept : data_() {}
 
 // --- Explicit basic constructors ---
-template <usize L, typename T> constexpr Vec<L, T>::Vec(T sca) noexcept : head_(sca), tail_() {}
+template <usize L, typename T> constexpr Vec<L, T>::Vec(T sca) noexcept : data_{sca} {}
 
 // --- Conversion constructors ---
-template <usize L, typename T> template          <typename A, typename... B> constexpr Vec<L, T>::Vec(       A         head, B... tail) noexcept : head_(static_cast<T>(head       )), tail_(             tail...) {}
-template <usize L, typename T> template          <typename A, typename... B> constexpr Vec<L, T>::Vec(Vec<1, A> const& head, B... tail) noexcept : head_(static_cast<T>(head.head())), tail_(             tail...) {}
-template <usize L, typename T> template <usize M, typename A, typename... B> constexpr Vec<L, T>::Vec(Vec<M, A> const& head, B... tail) noexcept : head_(static_cast<T>(head.head())), tail_(head.tail(), tail...) {}
+template <usize L, typename T> template <typename A, typename... B> constexpr Vec<L, T>::Vec(A const& head, B const&... tail) noexcept : data_() { static_assert(sizeof...(B) < L); [[maybe_unused]] usize idx = this->Insert(0, head); ((idx = this->Insert(idx, tail)), ...); }
+
+// --- Helpers ---
+template <usize L, typename T> template          <typename A> constexpr usize Vec<L, T>::Insert(usize idx,        A         sca) noexcept { assert(idx < this->Length()); this->data_[idx] = static_cast<T>(sca); return idx + 1; }
+template <usize L, typename T> template <usize M, typename A> constexpr usize Vec<L, T>::Insert(usize idx, Vec<M, A> const& vec) noexcept { for (usize jdx = 0; jdx < M && idx < L; ++jdx, ++idx) this->data_[idx] = static_cast<T>(vec[jdx]); return idx; }
 
 // --- Unary arithmetic operators ---
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator=(Vec<L, U> const& vec) { this->head_ = static_cast<T>(vec.head()); this->tail_ = vec.tail(); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator=(Vec<L, U> const& vec) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] = static_cast<T>(vec[idx]); return *this; }
 
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator+=(U sca) { this->head_ += static_cast<T>(sca); this->tail_ += sca; return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator-=(U sca) { this->head_ -= static_cast<T>(sca); this->tail_ -= sca; return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator*=(U sca) { this->head_ *= static_cast<T>(sca); this->tail_ *= sca; return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator/=(U sca) { this->head_ /= static_cast<T>(sca); this->tail_ /= sca; return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator%=(U sca) { this->head_ %= static_cast<T>(sca); this->tail_ %= sca; return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator+=(U sca) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] += static_cast<T>(sca); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator-=(U sca) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] -= static_cast<T>(sca); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator*=(U sca) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] *= static_cast<T>(sca); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator/=(U sca) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] /= static_cast<T>(sca); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator%=(U sca) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] %= static_cast<T>(sca); return *this; }
 
 template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator+=(Vec<1, U> const& vec) { return *this += vec.head(); }
 template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator-=(Vec<1, U> const& vec) { return *this -= vec.head(); }
@@ -217,24 +249,24 @@ template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L,
 template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator/=(Vec<1, U> const& vec) { return *this /= vec.head(); }
 template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator%=(Vec<1, U> const& vec) { return *this %= vec.head(); }
 
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator+=(Vec<L, U> const& vec) { this->head_ += static_cast<T>(vec.head()); this->tail_ += vec.tail(); return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator-=(Vec<L, U> const& vec) { this->head_ -= static_cast<T>(vec.head()); this->tail_ -= vec.tail(); return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator*=(Vec<L, U> const& vec) { this->head_ *= static_cast<T>(vec.head()); this->tail_ *= vec.tail(); return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator/=(Vec<L, U> const& vec) { this->head_ /= static_cast<T>(vec.head()); this->tail_ /= vec.tail(); return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator%=(Vec<L, U> const& vec) { this->head_ %= static_cast<T>(vec.head()); this->tail_ %= vec.tail(); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator+=(Vec<L, U> const& vec) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] += static_cast<T>(vec[idx]); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator-=(Vec<L, U> const& vec) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] -= static_cast<T>(vec[idx]); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator*=(Vec<L, U> const& vec) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] *= static_cast<T>(vec[idx]); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator/=(Vec<L, U> const& vec) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] /= static_cast<T>(vec[idx]); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator%=(Vec<L, U> const& vec) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] %= static_cast<T>(vec[idx]); return *this; }
 
-template <usize L, typename T> constexpr Vec<L, T>& Vec<L, T>::operator++() { ++this->head_; ++this->tail_; return *this; }
-template <usize L, typename T> constexpr Vec<L, T>& Vec<L, T>::operator--() { --this->head_; --this->tail_; return *this; }
+template <usize L, typename T> constexpr Vec<L, T>& Vec<L, T>::operator++() { for (LengthType idx = 0; idx < L; ++idx) ++this->data_[idx]; return *this; }
+template <usize L, typename T> constexpr Vec<L, T>& Vec<L, T>::operator--() { for (LengthType idx = 0; idx < L; ++idx) --this->data_[idx]; return *this; }
 
 template <usize L, typename T> constexpr Vec<L, T> Vec<L, T>::operator++(int) { Vec<L, T> result(*this); ++(*this); return result; }
 template <usize L, typename T> constexpr Vec<L, T> Vec<L, T>::operator--(int) { Vec<L, T> result(*this); --(*this); return result; }
 
 // --- Unary bit operators ---
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator&= (U sca) { this->head_ &=  static_cast<T>(sca); this->tail_ &=  sca; return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator|= (U sca) { this->head_ |=  static_cast<T>(sca); this->tail_ |=  sca; return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator^= (U sca) { this->head_ ^=  static_cast<T>(sca); this->tail_ ^=  sca; return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator<<=(U sca) { this->head_ <<= static_cast<T>(sca); this->tail_ <<= sca; return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator>>=(U sca) { this->head_ >>= static_cast<T>(sca); this->tail_ >>= sca; return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator&= (U sca) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] &= static_cast<T>(sca); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator|= (U sca) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] |= static_cast<T>(sca); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator^= (U sca) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] ^= static_cast<T>(sca); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator<<=(U sca) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] <<= static_cast<T>(sca); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator>>=(U sca) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] >>= static_cast<T>(sca); return *this; }
 
 template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator&= (Vec<1, U> const& vec) { return *this &=  vec.head(); }
 template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator|= (Vec<1, U> const& vec) { return *this |=  vec.head(); }
@@ -242,28 +274,28 @@ template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L,
 template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator<<=(Vec<1, U> const& vec) { return *this <<= vec.head(); }
 template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator>>=(Vec<1, U> const& vec) { return *this >>= vec.head(); }
 
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator&= (Vec<L, U> const& vec) { this->head_ &=  static_cast<T>(vec.head()); this->tail_ &=  vec.tail(); return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator|= (Vec<L, U> const& vec) { this->head_ |=  static_cast<T>(vec.head()); this->tail_ |=  vec.tail(); return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator^= (Vec<L, U> const& vec) { this->head_ ^=  static_cast<T>(vec.head()); this->tail_ ^=  vec.tail(); return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator<<=(Vec<L, U> const& vec) { this->head_ <<= static_cast<T>(vec.head()); this->tail_ <<= vec.tail(); return *this; }
-template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator>>=(Vec<L, U> const& vec) { this->head_ >>= static_cast<T>(vec.head()); this->tail_ >>= vec.tail(); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator&= (Vec<L, U> const& vec) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] &= static_cast<T>(vec[idx]); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator|= (Vec<L, U> const& vec) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] |= static_cast<T>(vec[idx]); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator^= (Vec<L, U> const& vec) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] ^= static_cast<T>(vec[idx]); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator<<=(Vec<L, U> const& vec) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] <<= static_cast<T>(vec[idx]); return *this; }
+template <usize L, typename T> template <typename U> constexpr Vec<L, T>& Vec<L, T>::operator>>=(Vec<L, U> const& vec) { for (LengthType idx = 0; idx < L; ++idx) this->data_[idx] >>= static_cast<T>(vec[idx]); return *this; }
 
 // --- Unary arithmetic operators ---
 template <usize L, typename T> constexpr Vec<L, T> operator+(Vec<L, T> const& vec) { return vec; }
-template <usize L, typename T> constexpr Vec<L, T> operator-(Vec<L, T> const& vec) { return Vec<L, T>(-vec.head(), -vec.tail()); }
+template <usize L, typename T> constexpr Vec<L, T> operator-(Vec<L, T> const& vec) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(-vec[idx]); return result; }
 
 // --- Binary arithmetic operators ---
-template <usize L, typename T> constexpr Vec<L, T> operator+(Vec<L, T> const& vec, T sca) { return Vec<L, T>(vec.head() + sca, vec.tail() + sca); }
-template <usize L, typename T> constexpr Vec<L, T> operator-(Vec<L, T> const& vec, T sca) { return Vec<L, T>(vec.head() - sca, vec.tail() - sca); }
-template <usize L, typename T> constexpr Vec<L, T> operator*(Vec<L, T> const& vec, T sca) { return Vec<L, T>(vec.head() * sca, vec.tail() * sca); }
-template <usize L, typename T> constexpr Vec<L, T> operator/(Vec<L, T> const& vec, T sca) { return Vec<L, T>(vec.head() / sca, vec.tail() / sca); }
-template <usize L, typename T> constexpr Vec<L, T> operator%(Vec<L, T> const& vec, T sca) { return Vec<L, T>(vec.head() % sca, vec.tail() % sca); }
-
-template <usize L, typename T> constexpr Vec<L, T> operator+(T sca, Vec<L, T> const& vec) { return Vec<L, T>(sca + vec.head(), sca + vec.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator-(T sca, Vec<L, T> const& vec) { return Vec<L, T>(sca - vec.head(), sca - vec.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator*(T sca, Vec<L, T> const& vec) { return Vec<L, T>(sca * vec.head(), sca * vec.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator/(T sca, Vec<L, T> const& vec) { return Vec<L, T>(sca / vec.head(), sca / vec.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator%(T sca, Vec<L, T> const& vec) { return Vec<L, T>(sca % vec.head(), sca % vec.tail()); }
+template <usize L, typename T> constexpr Vec<L, T> operator+(Vec<L, T> const& vec, T sca) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec[idx] + sca); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator-(Vec<L, T> const& vec, T sca) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec[idx] - sca); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator*(Vec<L, T> const& vec, T sca) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec[idx] * sca); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator/(Vec<L, T> const& vec, T sca) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec[idx] / sca); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator%(Vec<L, T> const& vec, T sca) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec[idx] % sca); return result; }
+
+template <usize L, typename T> constexpr Vec<L, T> operator+(T sca, Vec<L, T> const& vec) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(sca + vec[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator-(T sca, Vec<L, T> const& vec) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(sca - vec[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator*(T sca, Vec<L, T> const& vec) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(sca * vec[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator/(T sca, Vec<L, T> const& vec) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(sca / vec[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator%(T sca, Vec<L, T> const& vec) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(sca % vec[idx]); return result; }
 
 template <usize L, typename T> constexpr Vec<L, T> operator+(Vec<L, T> const& vec1, Vec<1, T> const& vec2) { return vec1 + vec2.head(); }
 template <usize L, typename T> constexpr Vec<L, T> operator-(Vec<L, T> const& vec1, Vec<1, T> const& vec2) { return vec1 - vec2.head(); }
@@ -277,27 +309,27 @@ template <usize L, typename T> constexpr Vec<L, T> operator*(Vec<1, T> const& ve
 template <usize L, typename T> constexpr Vec<L, T> operator/(Vec<1, T> const& vec1, Vec<L, T> const& vec2) { return vec1.head() / vec2; }
 template <usize L, typename T> constexpr Vec<L, T> operator%(Vec<1, T> const& vec1, Vec<L, T> const& vec2) { return vec1.head() % vec2; }
 
-template <usize L, typename T> constexpr Vec<L, T> operator+(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { return Vec<L, T>(vec1.head() + vec2.head(), vec1.tail() + vec2.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator-(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { return Vec<L, T>(vec1.head() - vec2.head(), vec1.tail() - vec2.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator*(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { return Vec<L, T>(vec1.head() * vec2.head(), vec1.tail() * vec2.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator/(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { return Vec<L, T>(vec1.head() / vec2.head(), vec1.tail() / vec2.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator%(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { return Vec<L, T>(vec1.head() % vec2.head(), vec1.tail() % vec2.tail()); }
+template <usize L, typename T> constexpr Vec<L, T> operator+(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec1[idx] + vec2[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator-(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec1[idx] - vec2[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator*(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec1[idx] * vec2[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator/(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec1[idx] / vec2[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator%(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec1[idx] % vec2[idx]); return result; }
 
 // --- Unary bit operators ---
-template <usize L, typename T> constexpr Vec<L, T> operator~(Vec<L, T> const& vec) { return Vec<L, T>(~vec.head(), ~vec.tail()); }
+template <usize L, typename T> constexpr Vec<L, T> operator~(Vec<L, T> const& vec) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(~vec[idx]); return result; }
 
 // --- Binary bit operators ---
-template <usize L, typename T> constexpr Vec<L, T> operator& (Vec<L, T> const& vec, T sca) { return Vec<L, T>(vec.head() &  sca, vec.tail() &  sca); }
-template <usize L, typename T> constexpr Vec<L, T> operator| (Vec<L, T> const& vec, T sca) { return Vec<L, T>(vec.head() |  sca, vec.tail() |  sca); }
-template <usize L, typename T> constexpr Vec<L, T> operator^ (Vec<L, T> const& vec, T sca) { return Vec<L, T>(vec.head() ^  sca, vec.tail() ^  sca); }
-template <usize L, typename T> constexpr Vec<L, T> operator<<(Vec<L, T> const& vec, T sca) { return Vec<L, T>(vec.head() << sca, vec.tail() << sca); }
-template <usize L, typename T> constexpr Vec<L, T> operator>>(Vec<L, T> const& vec, T sca) { return Vec<L, T>(vec.head() >> sca, vec.tail() >> sca); }
-
-template <usize L, typename T> constexpr Vec<L, T> operator& (T sca, Vec<L, T> const& vec) { return Vec<L, T>(sca &  vec.head(), sca &  vec.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator| (T sca, Vec<L, T> const& vec) { return Vec<L, T>(sca |  vec.head(), sca |  vec.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator^ (T sca, Vec<L, T> const& vec) { return Vec<L, T>(sca ^  vec.head(), sca ^  vec.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator<<(T sca, Vec<L, T> const& vec) { return Vec<L, T>(sca << vec.head(), sca << vec.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator>>(T sca, Vec<L, T> const& vec) { return Vec<L, T>(sca >> vec.head(), sca >> vec.tail()); }
+template <usize L, typename T> constexpr Vec<L, T> operator& (Vec<L, T> const& vec, T sca) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec[idx] & sca); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator| (Vec<L, T> const& vec, T sca) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec[idx] | sca); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator^ (Vec<L, T> const& vec, T sca) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec[idx] ^ sca); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator<<(Vec<L, T> const& vec, T sca) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec[idx] << sca); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator>>(Vec<L, T> const& vec, T sca) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec[idx] >> sca); return result; }
+
+template <usize L, typename T> constexpr Vec<L, T> operator& (T sca, Vec<L, T> const& vec) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(sca & vec[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator| (T sca, Vec<L, T> const& vec) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(sca | vec[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator^ (T sca, Vec<L, T> const& vec) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(sca ^ vec[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator<<(T sca, Vec<L, T> const& vec) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(sca << vec[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator>>(T sca, Vec<L, T> const& vec) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(sca >> vec[idx]); return result; }
 
 template <usize L, typename T> constexpr Vec<L, T> operator& (Vec<L, T> const& vec1, Vec<1, T> const& vec2) { return vec1 &  vec2.head(); }
 template <usize L, typename T> constexpr Vec<L, T> operator| (Vec<L, T> const& vec1, Vec<1, T> const& vec2) { return vec1 |  vec2.head(); }
@@ -311,21 +343,43 @@ template <usize L, typename T> constexpr Vec<L, T> operator^ (Vec<1, T> const& v
 template <usize L, typename T> constexpr Vec<L, T> operator<<(Vec<1, T> const& vec1, Vec<L, T> const& vec2) { return vec1.head() << vec2; }
 template <usize L, typename T> constexpr Vec<L, T> operator>>(Vec<1, T> const& vec1, Vec<L, T> const& vec2) { return vec1.head() >> vec2; }
 
-template <usize L, typename T> constexpr Vec<L, T> operator& (Vec<L, T> const& vec1, Vec<L, T> const& vec2) { return Vec<L, T>(vec1.head() &  vec2.head(), vec1.tail() &  vec2.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator| (Vec<L, T> const& vec1, Vec<L, T> const& vec2) { return Vec<L, T>(vec1.head() |  vec2.head(), vec1.tail() |  vec2.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator^ (Vec<L, T> const& vec1, Vec<L, T> const& vec2) { return Vec<L, T>(vec1.head() ^  vec2.head(), vec1.tail() ^  vec2.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator<<(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { return Vec<L, T>(vec1.head() << vec2.head(), vec1.tail() << vec2.tail()); }
-template <usize L, typename T> constexpr Vec<L, T> operator>>(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { return Vec<L, T>(vec1.head() >> vec2.head(), vec1.tail() >> vec2.tail()); }
+template <usize L, typename T> constexpr Vec<L, T> operator& (Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec1[idx] & vec2[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator| (Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec1[idx] | vec2[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator^ (Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec1[idx] ^ vec2[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator<<(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec1[idx] << vec2[idx]); return result; }
+template <usize L, typename T> constexpr Vec<L, T> operator>>(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, T> result; for (usize idx = 0; idx < L; ++idx) result[idx] = static_cast<T>(vec1[idx] >> vec2[idx]); return result; }
 
 // --- Boolean operators ---
-template <usize L, typename T> constexpr bool operator==(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { return vec1.head() == vec2.head() && vec1.tail() == vec2.tail(); }
+template <usize L, typename T> constexpr bool operator==(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { for (usize idx = 0; idx < L; ++idx) if (!(vec1[idx] == vec2[idx])) return false; return true; }
 template <usize L, typename T> constexpr bool operator!=(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { return !(vec1 == vec2); }
 
-template <usize L> constexpr Vec<L, bool> operator&&(Vec<L, bool> const& vec1, Vec<L, bool> const& vec2) { return Vec<L, bool>(vec1.head() && vec2.head(), vec1.tail() && vec2.tail()); }
-template <usize L> constexpr Vec<L, bool> operator||(Vec<L, bool> const& vec1, Vec<L, bool> const& vec2) { return Vec<L, bool>(vec1.head() || vec2.head(), vec1.tail() || vec2.tail()); }
+template <usize L> constexpr Vec<L, bool> operator&&(Vec<L, bool> const& vec1, Vec<L, bool> const& vec2) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = vec1[idx] && vec2[idx]; return result; }
+template <usize L> constexpr Vec<L, bool> operator||(Vec<L, bool> const& vec1, Vec<L, bool> const& vec2) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = vec1[idx] || vec2[idx]; return result; }
+
+// --- Comparison operators ---
+template <usize L, typename T> constexpr Vec<L, bool> operator< (Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = vec1[idx] <  vec2[idx]; return result; }
+template <usize L, typename T> constexpr Vec<L, bool> operator<=(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = vec1[idx] <= vec2[idx]; return result; }
+template <usize L, typename T> constexpr Vec<L, bool> operator> (Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = vec1[idx] >  vec2[idx]; return result; }
+template <usize L, typename T> constexpr Vec<L, bool> operator>=(Vec<L, T> const& vec1, Vec<L, T> const& vec2) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = vec1[idx] >= vec2[idx]; return result; }
+
+template <usize L, typename T> constexpr Vec<L, bool> operator< (Vec<L, T> const& vec, T sca) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = vec[idx] <  sca; return result; }
+template <usize L, typename T> constexpr Vec<L, bool> operator<=(Vec<L, T> const& vec, T sca) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = vec[idx] <= sca; return result; }
+template <usize L, typename T> constexpr Vec<L, bool> operator> (Vec<L, T> const& vec, T sca) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = vec[idx] >  sca; return result; }
+template <usize L, typename T> constexpr Vec<L, bool> operator>=(Vec<L, T> const& vec, T sca) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = vec[idx] >= sca; return result; }
+
+template <usize L, typename T> constexpr Vec<L, bool> operator< (T sca, Vec<L, T> const& vec) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = sca <  vec[idx]; return result; }
+template <usize L, typename T> constexpr Vec<L, bool> operator<=(T sca, Vec<L, T> const& vec) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = sca <= vec[idx]; return result; }
+template <usize L, typename T> constexpr Vec<L, bool> operator> (T sca, Vec<L, T> const& vec) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = sca >  vec[idx]; return result; }
+template <usize L, typename T> constexpr Vec<L, bool> operator>=(T sca, Vec<L, T> const& vec) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = sca >= vec[idx]; return result; }
+
+template <usize L> constexpr Vec<L, bool> operator!(Vec<L, bool> const& vec) { Vec<L, bool> result; for (usize idx = 0; idx < L; ++idx) result[idx] = !vec[idx]; return result; }
 
 }  // namespace tf
 
 #undef L
 
+#ifdef TRANSFORM_SIMD_PORTABLE
+#include "transform/simd/vecn.h"
+#endif
+
 #endif  // TRANSFORM_VEC_VECN_H_